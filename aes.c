@@ -390,6 +390,19 @@ void prg(const uint8_t* key, const uint8_t* iv, uint8_t* out, unsigned int seclv
 #endif
 }
 
+void prg_range(const uint8_t* key, const uint8_t* iv, size_t block_offset, uint8_t* out,
+               unsigned int seclvl, size_t nblocks) {
+  // The counter is the big-endian 128 bit integer starting at iv
+  uint8_t internal_iv[16];
+  uint64_t carry = block_offset;
+  for (unsigned int i = 16; i > 0; i--) {
+    carry += iv[i - 1];
+    internal_iv[i - 1] = carry & 0xff;
+    carry >>= 8;
+  }
+  prg(key, internal_iv, out, seclvl, nblocks * 16);
+}
+
 uint8_t* aes_extend_witness(const uint8_t* key, const uint8_t* in, const faest_paramset_t* params) {
   const unsigned int lambda     = params->faest_param.lambda;
   const unsigned int l          = params->faest_param.l;
@@ -55,6 +55,9 @@ int expand_key(aes_round_keys_t* round_keys, const uint8_t* key, unsigned int ke
                unsigned int block_words, unsigned int num_rounds);
 
 void prg(const uint8_t* key, const uint8_t* iv, uint8_t* out, unsigned int bits, size_t outlen);
+// Output blocks [block_offset, block_offset + nblocks) of the stream produced by prg
+void prg_range(const uint8_t* key, const uint8_t* iv, size_t block_offset, uint8_t* out,
+               unsigned int bits, size_t nblocks);
 FAEST_END_C_DECL
 
 #endif
@@ -0,0 +1,50 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "arena.h"
+#include "compat.h"
+
+#include <stdlib.h>
+
+bool faest_arena_init(faest_arena_t* arena, size_t size) {
+  arena->size = faest_arena_bytes(size);
+  arena->used = 0;
+  arena->base = arena->size ? faest_aligned_alloc(FAEST_ARENA_ALIGNMENT, arena->size) : NULL;
+  if (!arena->base) {
+    arena->size = 0;
+  }
+  return arena->base != NULL || !size;
+}
+
+void faest_arena_clear(faest_arena_t* arena) {
+  if (arena->base) {
+    faest_explicit_bzero(arena->base, arena->size);
+    faest_aligned_free(arena->base);
+  }
+  arena->base = NULL;
+  arena->size = 0;
+  arena->used = 0;
+}
+
+void* faest_arena_alloc(faest_arena_t* arena, size_t size) {
+  const size_t bytes = faest_arena_bytes(size ? size : 1);
+  if (arena && arena->size - arena->used >= bytes) {
+    void* ptr = arena->base + arena->used;
+    arena->used += bytes;
+    return ptr;
+  }
+  return faest_aligned_alloc(FAEST_ARENA_ALIGNMENT, bytes);
+}
+
+void faest_arena_free(faest_arena_t* arena, void* ptr) {
+  if (arena && arena->base && (uintptr_t)ptr >= (uintptr_t)arena->base &&
+      (uintptr_t)ptr < (uintptr_t)(arena->base + arena->size)) {
+    return;
+  }
+  faest_aligned_free(ptr);
+}
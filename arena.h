@@ -0,0 +1,54 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+#ifndef FAEST_ARENA_H
+#define FAEST_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "macros.h"
+
+FAEST_BEGIN_C_DECL
+
+#define FAEST_ARENA_ALIGNMENT 32
+
+// Bump allocator over one preallocated buffer. Allocations are released in reverse order by
+// resetting to a mark. If the arena is NULL or exhausted, allocations fall back to the heap.
+typedef struct faest_arena_t {
+  uint8_t* base;
+  size_t size;
+  size_t used;
+} faest_arena_t;
+
+// Bytes taken from an arena by an allocation of size bytes
+static inline size_t faest_arena_bytes(size_t size) {
+  return (size + FAEST_ARENA_ALIGNMENT - 1) & ~(size_t)(FAEST_ARENA_ALIGNMENT - 1);
+}
+
+bool faest_arena_init(faest_arena_t* arena, size_t size);
+// Zero and free the buffer of the arena
+void faest_arena_clear(faest_arena_t* arena);
+
+// Allocate size bytes aligned to FAEST_ARENA_ALIGNMENT
+void* faest_arena_alloc(faest_arena_t* arena, size_t size);
+// Free an allocation of faest_arena_alloc. Allocations within the arena are only released by
+// faest_arena_reset.
+void faest_arena_free(faest_arena_t* arena, void* ptr);
+
+static inline size_t faest_arena_mark(const faest_arena_t* arena) {
+  return arena ? arena->used : 0;
+}
+
+// Release all allocations done after mark was taken
+static inline void faest_arena_reset(faest_arena_t* arena, size_t mark) {
+  if (arena) {
+    arena->used = mark;
+  }
+}
+
+FAEST_END_C_DECL
+
+#endif
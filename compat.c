@@ -142,3 +142,26 @@ void faest_explicit_bzero(void* a, size_t len) {
 #endif
 }
 #endif /* HAVE_EXPLICIT_BZERO */
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+uint64_t faest_monotonic_ns(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency, counter;
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)counter.QuadPart / (uint64_t)frequency.QuadPart * UINT64_C(1000000000) +
+         (uint64_t)counter.QuadPart % (uint64_t)frequency.QuadPart * UINT64_C(1000000000) /
+             (uint64_t)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+#else
+  return (uint64_t)clock() * UINT64_C(1000000000) / CLOCKS_PER_SEC;
+#endif
+}
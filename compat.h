@@ -120,6 +120,15 @@ static inline bool sub_overflow_size_t(const size_t x, const size_t y, size_t* d
 #include <stdint.h>
 #include <limits.h>
 
+FAEST_BEGIN_C_DECL
+
+/**
+ * Nanoseconds of a monotonic clock, for measurements only.
+ */
+uint64_t faest_monotonic_ns(void);
+
+FAEST_END_C_DECL
+
 /* helper functions for left and right rotations of bytes */
 #if GNUC_CHECK(4, 9) && (defined(__x86_64__) || defined(__i386__))
 #include <x86intrin.h>
@@ -247,17 +247,33 @@ static void hash_challenge_3(uint8_t* chall_3, const uint8_t* chall_2, const uin
   H2_final(&h2_ctx_2, chall_3, lambda_bytes);
 }
 
-void faest_sign(uint8_t* sig, const uint8_t* msg, size_t msglen, const uint8_t* owf_key,
-                const uint8_t* owf_input, const uint8_t* owf_output, const uint8_t* rho,
-                size_t rholen, const faest_paramset_t* params) {
+typedef struct hash_v_ctx_t {
+  H1_context_t h1_ctx;
+  const uint8_t* chall_1;
+  unsigned int l;
+  unsigned int lambda;
+} hash_v_ctx_t;
+
+static void hash_v_column(void* ctx, const uint8_t* column) {
+  hash_v_ctx_t* hash_ctx = ctx;
+
+  uint8_t V_tilde[MAX_LAMBDA_BYTES + UNIVERSAL_HASH_B];
+  vole_hash(V_tilde, hash_ctx->chall_1, column, hash_ctx->l, hash_ctx->lambda);
+  H1_update(&hash_ctx->h1_ctx, V_tilde, hash_ctx->lambda / 8 + UNIVERSAL_HASH_B);
+}
+
+int faest_sign(uint8_t* sig, const uint8_t* msg, size_t msglen, const uint8_t* owf_key,
+               const uint8_t* owf_input, const uint8_t* owf_output, const uint8_t* rho,
+               size_t rholen, const vbb_config_t* config, const faest_paramset_t* params) {
   const unsigned int l           = params->faest_param.l;
   const unsigned int ell_bytes   = l / 8;
   const unsigned int lambda      = params->faest_param.lambda;
   const unsigned int lambdaBytes = lambda / 8;
   const unsigned int tau         = params->faest_param.tau;
   const unsigned int tau0        = params->faest_param.t0;
-  const unsigned int ell_hat     = l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
-  // const unsigned int ell_hat_bytes = ell_hat / 8;
+  if (!vbb_row_count_from_budget(config->max_vole_bytes, params)) {
+    return -1;
+  }
 
   uint8_t mu[MAX_LAMBDA_BYTES * 2];
   hash_mu(mu, owf_input, owf_output, params->faest_param.pkSize / 2, msg, msglen, lambda);
@@ -275,7 +291,7 @@ void faest_sign(uint8_t* sig, const uint8_t* msg, size_t msglen, const uint8_t*
   }
 
   vbb_t vbb;
-  init_vbb_sign(&vbb, ell_hat, rootkey, signature_iv(sig, params), signature_c(sig, 0, params),
+  init_vbb_sign(&vbb, config, rootkey, signature_iv(sig, params), signature_c(sig, 0, params),
                 params);
 
   uint8_t chall_1[(5 * MAX_LAMBDA_BYTES) + 8];
@@ -284,18 +300,12 @@ void faest_sign(uint8_t* sig, const uint8_t* msg, size_t msglen, const uint8_t*
 
   vole_hash(signature_u_tilde(sig, params), chall_1, get_vole_u(&vbb), l, lambda);
 
-  prepare_hash_sign(&vbb);
   uint8_t h_v[MAX_LAMBDA_BYTES * 2];
   {
-    H1_context_t h1_ctx_1;
-    H1_init(&h1_ctx_1, lambda);
-
-    uint8_t V_tilde[MAX_LAMBDA_BYTES + UNIVERSAL_HASH_B];
-    for (unsigned int i = 0; i != lambda; ++i) {
-      vole_hash(V_tilde, chall_1, get_vole_v_hash(&vbb, i), l, lambda);
-      H1_update(&h1_ctx_1, V_tilde, lambdaBytes + UNIVERSAL_HASH_B);
-    }
-    H1_final(&h1_ctx_1, h_v, lambdaBytes * 2);
+    hash_v_ctx_t hash_ctx = {.chall_1 = chall_1, .l = l, .lambda = lambda};
+    H1_init(&hash_ctx.h1_ctx, lambda);
+    hash_columns_sign(&vbb, hash_v_column, &hash_ctx);
+    H1_final(&hash_ctx.h1_ctx, h_v, lambdaBytes * 2);
   }
   uint8_t* w = aes_extend_witness(owf_key, owf_input, params);
   xor_u8_array(w, get_vole_u(&vbb), signature_d(sig, params), ell_bytes);
@@ -324,18 +334,22 @@ void faest_sign(uint8_t* sig, const uint8_t* msg, size_t msglen, const uint8_t*
                          depth);
   }
   clean_vbb(&vbb);
+  return 0;
 }
 
 int faest_verify(const uint8_t* msg, size_t msglen, const uint8_t* sig, const uint8_t* owf_input,
-                 const uint8_t* owf_output, const faest_paramset_t* params) {
+                 const uint8_t* owf_output, const vbb_config_t* config,
+                 const faest_paramset_t* params) {
   const unsigned int l           = params->faest_param.l;
   const unsigned int lambda      = params->faest_param.lambda;
   const unsigned int lambdaBytes = lambda / 8;
   const unsigned int tau         = params->faest_param.tau;
-  const unsigned int ell_hat     = l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+  if (!vbb_row_count_from_budget(config->max_vole_bytes, params)) {
+    return -1;
+  }
 
   vbb_t vbb;
-  init_vbb_verify(&vbb, ell_hat, params, sig);
+  init_vbb_verify(&vbb, config, params, sig);
 
   uint8_t mu[MAX_LAMBDA_BYTES * 2];
   hash_mu(mu, owf_input, owf_output, params->faest_param.pkSize / 2, msg, msglen, lambda);
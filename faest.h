@@ -9,13 +9,19 @@
 #include <stddef.h>
 
 #include "instances.h"
+#include "vbb.h"
 
-void faest_sign(uint8_t* sig, const uint8_t* msg, size_t msglen, const uint8_t* owf_key,
-                const uint8_t* owf_input, const uint8_t* owf_output, const uint8_t* rho,
-                size_t rholen, const faest_paramset_t* params);
+// config bounds the memory used to hold the VOLE correlations. Returns -1 if the budget is too
+// small to produce a signature.
+int faest_sign(uint8_t* sig, const uint8_t* msg, size_t msglen, const uint8_t* owf_key,
+               const uint8_t* owf_input, const uint8_t* owf_output, const uint8_t* rho,
+               size_t rholen, const vbb_config_t* config, const faest_paramset_t* params);
 
+// config bounds the memory used to hold the VOLE correlations. Returns -1 if the budget is too
+// small or the signature is invalid.
 int faest_verify(const uint8_t* msg, size_t msglen, const uint8_t* sig, const uint8_t* owf_input,
-                 const uint8_t* owf_output, const faest_paramset_t* params);
+                 const uint8_t* owf_output, const vbb_config_t* config,
+                 const faest_paramset_t* params);
 
 ATTR_PURE const uint8_t* dsignature_iv(const uint8_t* base_ptr, const faest_paramset_t* params);
 ATTR_PURE const uint8_t* dsignature_chall_3(const uint8_t* base_ptr,
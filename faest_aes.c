@@ -76,54 +76,6 @@ static const bf8_t Rcon[30] = {
     0x2f, 0x5e, 0xbc, 0x63, 0xc6, 0x97, 0x35, 0x6a, 0xd4, 0xb3, 0x7d, 0xfa, 0xef, 0xc5, 0x91,
 };
 
-bf128_t* column_to_row_major_and_shrink_V_128(uint8_t** v, unsigned int ell) {
-  // V is \hat \ell times \lambda matrix over F_2
-  // v has \hat \ell rows, \lambda columns, storing in column-major order, new_v has \ell + \lambda
-  // rows and \lambda columns storing in row-major order
-  bf128_t* new_v = faest_aligned_alloc(BF128_ALIGN, (ell + FAEST_128F_LAMBDA) * sizeof(bf128_t));
-  for (unsigned int row = 0; row != ell + FAEST_128F_LAMBDA; ++row) {
-    uint8_t new_row[BF128_NUM_BYTES] = {0};
-    for (unsigned int column = 0; column != FAEST_128F_LAMBDA; ++column) {
-      ptr_set_bit(new_row, ptr_get_bit(v[column], row), column);
-    }
-    new_v[row] = bf128_load(new_row);
-  }
-
-  return new_v;
-}
-
-bf192_t* column_to_row_major_and_shrink_V_192(uint8_t** v, unsigned int ell) {
-  // V is \hat \ell times \lambda matrix over F_2
-  // v has \hat \ell rows, \lambda columns, storing in column-major order, new_v has \ell + \lambda
-  // rows and \lambda columns storing in row-major order
-  bf192_t* new_v = faest_aligned_alloc(BF192_ALIGN, (ell + FAEST_192F_LAMBDA) * sizeof(bf192_t));
-  for (unsigned int row = 0; row != ell + FAEST_192F_LAMBDA; ++row) {
-    uint8_t new_row[BF192_NUM_BYTES] = {0};
-    for (unsigned int column = 0; column != FAEST_192F_LAMBDA; ++column) {
-      ptr_set_bit(new_row, ptr_get_bit(v[column], row), column);
-    }
-    new_v[row] = bf192_load(new_row);
-  }
-
-  return new_v;
-}
-
-bf256_t* column_to_row_major_and_shrink_V_256(uint8_t** v, unsigned int ell) {
-  // V is \hat \ell times \lambda matrix over F_2
-  // v has \hat \ell rows, \lambda columns, storing in column-major order, new_v has \ell + \lambda
-  // rows and \lambda columns storing in row-major order
-  bf256_t* new_v = faest_aligned_alloc(BF256_ALIGN, (ell + FAEST_256F_LAMBDA) * sizeof(bf256_t));
-  for (unsigned int row = 0; row != ell + FAEST_256F_LAMBDA; ++row) {
-    uint8_t new_row[BF256_NUM_BYTES] = {0};
-    for (unsigned int column = 0; column != FAEST_256F_LAMBDA; ++column) {
-      ptr_set_bit(new_row, ptr_get_bit(v[column], row), column);
-    }
-    new_v[row] = bf256_load(new_row);
-  }
-
-  return new_v;
-}
-
 // m == 1 implementations
 
 static void aes_key_schedule_forward_1(const uint8_t* x, uint8_t* out,
@@ -224,9 +176,9 @@ static void aes_key_schedule_backward_128_vbb_vk(vbb_t* vbb, uint8_t Mtag, uint8
   for (unsigned int j = 0; j < FAEST_128F_Ske; j++) {
     // Step 7
     bf128_t bf_x_tilde[8];
+    get_vole_v_128_range(vbb, 8 * j + FAEST_128F_LAMBDA, 8, bf_x_tilde);
     for (unsigned int i = 0; i < 8; i++) {
-      bf_x_tilde[i] = bf128_add(*get_vole_v_128(vbb, (8 * j + i) + FAEST_128F_LAMBDA),
-                                *get_vk_128(vbb, iwd + 8 * c + i));
+      bf_x_tilde[i] = bf128_add(bf_x_tilde[i], *get_vk_128(vbb, iwd + 8 * c + i));
     }
 
     if (Mtag == 0 && c == 0) {
@@ -654,9 +606,9 @@ static void aes_key_schedule_backward_192_vbb_vk(vbb_t* vbb, uint8_t Mtag, uint8
   for (unsigned int j = 0; j < FAEST_192F_Ske; j++) {
     // Step 7
     bf192_t bf_x_tilde[8];
+    get_vole_v_192_range(vbb, 8 * j + FAEST_192F_LAMBDA, 8, bf_x_tilde);
     for (unsigned int i = 0; i < 8; i++) {
-      bf_x_tilde[i] = bf192_add(*get_vole_v_192(vbb, (8 * j + i) + FAEST_192F_LAMBDA),
-                                *get_vk_192(vbb, iwd + 8 * c + i));
+      bf_x_tilde[i] = bf192_add(bf_x_tilde[i], *get_vk_192(vbb, iwd + 8 * c + i));
     }
 
     if (Mtag == 0 && c == 0) {
@@ -1088,9 +1040,9 @@ static void aes_key_schedule_backward_256_vbb_vk(vbb_t* vbb, uint8_t Mtag, uint8
   for (unsigned int j = 0; j < FAEST_256F_Ske; j++) {
     // Step 7
     bf256_t bf_x_tilde[8];
+    get_vole_v_256_range(vbb, 8 * j + FAEST_256F_LAMBDA, 8, bf_x_tilde);
     for (unsigned int i = 0; i < 8; i++) {
-      bf_x_tilde[i] = bf256_add(*get_vole_v_256(vbb, (8 * j + i) + FAEST_256F_LAMBDA),
-                                *get_vk_256(vbb, iwd + 8 * c + i)); // Vk[iwd + 8 * c + i]);
+      bf_x_tilde[i] = bf256_add(bf_x_tilde[i], *get_vk_256(vbb, iwd + 8 * c + i)); // Vk[iwd + 8 * c + i]);
     }
 
     if (Mtag == 0 && rmvRcon == true && c == 0) {
@@ -1685,9 +1637,7 @@ static void em_enc_backward_128_linear_access_verify(vbb_t* vbb, const bf128_t*
                      FAEST_EM_128F_Nwd;
 
     bf128_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; i++) {
-      memcpy(bf_z_tilde + i, get_vole_v_128(vbb, chunk_idx + i), sizeof(bf128_t));
-    }
+    get_vole_v_128_range(vbb, chunk_idx, 8, bf_z_tilde);
 
     bf128_t bf_y_tilde[8];
     for (unsigned int i = 0; i < 8; ++i) {
@@ -1716,9 +1666,9 @@ static void em_enc_backward_128_vbb_linear_access(vbb_t* vbb, const bf128_t* bf_
     unsigned int c   = ((chunk_idx - 8 * r) / 32 + r) % FAEST_EM_128F_Nwd;
 
     bf128_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; ++i) {
-      bf_z_tilde[i] = *get_vole_v_128(vbb_out, chunk_idx + i);
-      if (bf_x) {
+    get_vole_v_128_range(vbb_out, chunk_idx, 8, bf_z_tilde);
+    if (bf_x) {
+      for (unsigned int i = 0; i < 8; ++i) {
         bf_z_tilde[i] = bf128_add(bf_z_tilde[i], bf_x[ird + i]);
       }
     }
@@ -1743,9 +1693,7 @@ static void em_enc_backward_128_vbb_linear_access(vbb_t* vbb, const bf128_t* bf_
                      FAEST_EM_128F_Nwd;
 
     bf128_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; i++) {
-      memcpy(bf_z_tilde + i, get_vole_v_128(vbb, chunk_idx + i), sizeof(bf128_t));
-    }
+    get_vole_v_128_range(vbb, chunk_idx, 8, bf_z_tilde);
 
     bf128_t bf_y_tilde[8];
     for (unsigned int i = 0; i < 8; ++i) {
@@ -2049,9 +1997,7 @@ static void em_enc_backward_192_linear_access_verify(vbb_t* vbb, const bf192_t*
                      FAEST_EM_192F_Nwd;
 
     bf192_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; i++) {
-      memcpy(bf_z_tilde + i, get_vole_v_192(vbb, chunk_idx + i), sizeof(bf192_t));
-    }
+    get_vole_v_192_range(vbb, chunk_idx, 8, bf_z_tilde);
 
     bf192_t bf_y_tilde[8];
     for (unsigned int i = 0; i < 8; ++i) {
@@ -2080,9 +2026,9 @@ static void em_enc_backward_192_vbb_linear_access(vbb_t* vbb, const bf192_t* bf_
     unsigned int c   = ((chunk_idx - 8 * r) / 32 + r) % FAEST_EM_192F_Nwd;
 
     bf192_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; ++i) {
-      bf_z_tilde[i] = *get_vole_v_192(vbb_out, chunk_idx + i);
-      if (bf_x) {
+    get_vole_v_192_range(vbb_out, chunk_idx, 8, bf_z_tilde);
+    if (bf_x) {
+      for (unsigned int i = 0; i < 8; ++i) {
         bf_z_tilde[i] = bf192_add(bf_z_tilde[i], bf_x[ird + i]);
       }
     }
@@ -2107,9 +2053,7 @@ static void em_enc_backward_192_vbb_linear_access(vbb_t* vbb, const bf192_t* bf_
                      FAEST_EM_192F_Nwd;
 
     bf192_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; i++) {
-      memcpy(bf_z_tilde + i, get_vole_v_192(vbb, chunk_idx + i), sizeof(bf192_t));
-    }
+    get_vole_v_192_range(vbb, chunk_idx, 8, bf_z_tilde);
 
     bf192_t bf_y_tilde[8];
     for (unsigned int i = 0; i < 8; ++i) {
@@ -2481,9 +2425,7 @@ static void em_enc_backward_256_linear_access_verify(vbb_t* vbb, const bf8_t* x,
     }
 
     bf256_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; i++) {
-      memcpy(bf_z_tilde + i, get_vole_v_256(vbb, chunk_idx + i), sizeof(bf256_t));
-    }
+    get_vole_v_256_range(vbb, chunk_idx, 8, bf_z_tilde);
 
     bf256_t bf_y_tilde[8];
     for (unsigned int i = 0; i < 8; ++i) {
@@ -2516,9 +2458,9 @@ static void em_enc_backward_256_vbb_linear_access(vbb_t* vbb, const bf256_t* bf_
     }
 
     bf256_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; ++i) {
-      bf_z_tilde[i] = *get_vole_v_256(vbb_out, chunk_idx + i);
-      if (bf_x) {
+    get_vole_v_256_range(vbb_out, chunk_idx, 8, bf_z_tilde);
+    if (bf_x) {
+      for (unsigned int i = 0; i < 8; ++i) {
         bf_z_tilde[i] = bf256_add(bf_z_tilde[i], bf_x[ird + i]);
       }
     }
@@ -2547,9 +2489,7 @@ static void em_enc_backward_256_vbb_linear_access(vbb_t* vbb, const bf256_t* bf_
     }
 
     bf256_t bf_z_tilde[8];
-    for (unsigned int i = 0; i < 8; i++) {
-      memcpy(bf_z_tilde + i, get_vole_v_256(vbb, chunk_idx + i), sizeof(bf256_t));
-    }
+    get_vole_v_256_range(vbb, chunk_idx, 8, bf_z_tilde);
 
     bf256_t bf_y_tilde[8];
     for (unsigned int i = 0; i < 8; ++i) {
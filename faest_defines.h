@@ -19,4 +19,35 @@
 #define FAEST_CALLING_CONVENTION
 #endif
 
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Statistics of the VOLE cache of a single signing or verification call. They show how much work
+ * a memory budget causes for recomputing VOLE correlations.
+ */
+typedef struct faest_vbb_stats_t {
+  uint64_t row_hits;              /* Row accesses served from a cached window */
+  uint64_t row_misses;            /* Row accesses that recomputed a window */
+  uint64_t row_prefetch_hits;     /* Row accesses served from a window computed in the background */
+  uint64_t column_hits;           /* Column accesses served from the cache */
+  uint64_t column_misses;         /* Column accesses that recomputed the cached columns */
+  uint64_t row_recomputations;    /* Row windows recomputed by the signer */
+  uint64_t row_reconstructions;   /* Row windows reconstructed by the verifier */
+  uint64_t column_recomputations; /* Recomputations of cached columns */
+  uint64_t leaves_expanded;       /* GGM tree leaves expanded with the PRG */
+  uint64_t prg_bytes;             /* Bytes generated by the PRG from the leaves */
+  uint64_t recompute_ns;          /* Time spent on recomputations in the calling thread */
+} faest_vbb_stats_t;
+
+/**
+ * Split of a memory budget between the cached VOLE correlations and the checkpoint of the GGM
+ * trees, see faest_<param>_tune_vole_budget().
+ */
+typedef struct faest_vbb_tuning_t {
+  size_t max_vole_bytes;         /* Memory budget of the VOLE correlations */
+  unsigned int row_segments;     /* Number of independently cached row windows */
+  unsigned int checkpoint_level; /* GGM tree level kept for recomputations, 0 if none */
+} faest_vbb_tuning_t;
+
 #endif
@@ -172,11 +172,9 @@ bf128_t bf128_byte_combine_vk(vbb_t* vbb, unsigned int offset) {
   return bf_out;
 }
 bf128_t bf128_byte_combine_vbb(vbb_t* vbb, unsigned int offset) {
-  bf128_t bf_out = *get_vole_v_128(vbb, offset);
-  for (unsigned int i = 1; i < 8; ++i) {
-    bf_out = bf128_add(bf_out, bf128_mul(*get_vole_v_128(vbb, offset + i), bf128_alpha[i - 1]));
-  }
-  return bf_out;
+  bf128_t x[8];
+  get_vole_v_128_range(vbb, offset, 8, x);
+  return bf128_byte_combine(x);
 }
 
 bf128_t bf128_byte_combine_bits(uint8_t x) {
@@ -345,11 +343,9 @@ bf128_t bf128_sum_poly(const bf128_t* xs) {
 }
 
 bf128_t bf128_sum_poly_vbb(vbb_t* vbb, unsigned int offset) {
-  bf128_t ret = *get_vole_v_128(vbb, offset + 128 - 1);
-  for (size_t i = 1; i < 128; ++i) {
-    ret = bf128_add(bf128_dbl(ret), *get_vole_v_128(vbb, offset + 128 - 1 - i));
-  }
-  return ret;
+  bf128_t xs[128];
+  get_vole_v_128_range(vbb, offset, 128, xs);
+  return bf128_sum_poly(xs);
 }
 
 // GF(2^192) implementation
@@ -393,11 +389,9 @@ bf192_t bf192_byte_combine_vk(vbb_t* vbb, unsigned int offset) {
   return bf_out;
 }
 bf192_t bf192_byte_combine_vbb(vbb_t* vbb, unsigned int offset) {
-  bf192_t bf_out = *get_vole_v_192(vbb, offset);
-  for (unsigned int i = 1; i < 8; ++i) {
-    bf_out = bf192_add(bf_out, bf192_mul(*get_vole_v_192(vbb, offset + i), bf192_alpha[i - 1]));
-  }
-  return bf_out;
+  bf192_t x[8];
+  get_vole_v_192_range(vbb, offset, 8, x);
+  return bf192_byte_combine(x);
 }
 
 bf192_t bf192_byte_combine_bits(uint8_t x) {
@@ -583,11 +577,9 @@ bf192_t bf192_sum_poly(const bf192_t* xs) {
 }
 
 bf192_t bf192_sum_poly_vbb(vbb_t* vbb, unsigned int offset) {
-  bf192_t ret = *get_vole_v_192(vbb, offset + 192 - 1);
-  for (size_t i = 1; i < 192; ++i) {
-    ret = bf192_add(bf192_dbl(ret), *get_vole_v_192(vbb, offset + 192 - 1 - i));
-  }
-  return ret;
+  bf192_t xs[192];
+  get_vole_v_192_range(vbb, offset, 192, xs);
+  return bf192_sum_poly(xs);
 }
 
 // GF(2^256) implementation
@@ -639,11 +631,9 @@ bf256_t bf256_byte_combine_vk(vbb_t* vbb, unsigned int offset) {
   return bf_out;
 }
 bf256_t bf256_byte_combine_vbb(vbb_t* vbb, unsigned int offset) {
-  bf256_t bf_out = *get_vole_v_256(vbb, offset);
-  for (unsigned int i = 1; i < 8; ++i) {
-    bf_out = bf256_add(bf_out, bf256_mul(*get_vole_v_256(vbb, offset + i), bf256_alpha[i - 1]));
-  }
-  return bf_out;
+  bf256_t x[8];
+  get_vole_v_256_range(vbb, offset, 8, x);
+  return bf256_byte_combine(x);
 }
 
 bf256_t bf256_byte_combine_bits(uint8_t x) {
@@ -873,9 +863,7 @@ bf256_t bf256_sum_poly(const bf256_t* xs) {
 }
 
 bf256_t bf256_sum_poly_vbb(vbb_t* vbb, unsigned int offset) {
-  bf256_t ret = *get_vole_v_256(vbb, offset + 256 - 1);
-  for (size_t i = 1; i < 256; ++i) {
-    ret = bf256_add(bf256_dbl(ret), *get_vole_v_256(vbb, offset + 256 - 1 - i));
-  }
-  return ret;
+  bf256_t xs[256];
+  get_vole_v_256_range(vbb, offset, 256, xs);
+  return bf256_sum_poly(xs);
 }
@@ -9,6 +9,7 @@
 #include "tvs_aes.hpp"
 
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <array>
 
 namespace {
@@ -476,6 +477,32 @@ BOOST_AUTO_TEST_CASE(test_prg_256) {
   BOOST_TEST(output_256 == expected_256);
 }
 
+BOOST_AUTO_TEST_CASE(test_prg_range) {
+  constexpr uint8_t key[32] = {
+      0xf6, 0x48, 0x81, 0x8b, 0xa4, 0xa6, 0x65, 0x6b, 0xe0, 0xcb, 0x6e,
+      0x38, 0x2a, 0x5d, 0xff, 0x72, 0xac, 0x1d, 0xda, 0x96, 0x90, 0x81,
+      0x37, 0x47, 0x8b, 0xd5, 0x36, 0xcf, 0x4b, 0x77, 0x8a, 0xde,
+  };
+  // the counter carries into the upper bytes within the stream
+  constexpr uint8_t iv[16] = {
+      0x97, 0x67, 0xc2, 0x18, 0x8e, 0x12, 0xe6, 0x5b,
+      0x13, 0x64, 0xf5, 0xd8, 0x71, 0x7b, 0xff, 0xfa,
+  };
+
+  for (unsigned int bits : {128u, 192u, 256u}) {
+    uint8_t expected[15 * 16] = {0};
+    prg(key, iv, expected, bits, sizeof(expected));
+
+    for (size_t offset = 0; offset < 15; ++offset) {
+      for (size_t nblocks = 1; offset + nblocks <= 15; nblocks += 3) {
+        uint8_t output[15 * 16] = {0};
+        prg_range(key, iv, offset, output, bits, nblocks);
+        BOOST_TEST(std::equal(output, output + nblocks * 16, expected + offset * 16));
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_extend_witness_aes128) {
   std::array<uint8_t, 200> extended_witness = {};
   faest_paramset_t params = faest_get_paramset(FAEST_128S); // Just using the FAEST-128s
@@ -0,0 +1,535 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+#include "vbb.h"
+#include "vbb_tuning.h"
+#include "instances.hpp"
+#include "randomness.h"
+#include "utils.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+#include <array>
+#include <vector>
+
+namespace {
+  constexpr faest_paramid_t fast_parameters[] = {
+      FAEST_128F,
+      FAEST_EM_128F,
+      FAEST_192F,
+      FAEST_256F,
+  };
+
+  std::vector<uint8_t> get_row(vbb_t* vbb, unsigned int idx) {
+    const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+    const uint8_t* row;
+    switch (lambda_bytes) {
+    case 16:
+      row = reinterpret_cast<const uint8_t*>(get_vole_v_128(vbb, idx));
+      break;
+    case 24:
+      row = reinterpret_cast<const uint8_t*>(get_vole_v_192(vbb, idx));
+      break;
+    default:
+      row = reinterpret_cast<const uint8_t*>(get_vole_v_256(vbb, idx));
+      break;
+    }
+    return std::vector<uint8_t>(row, row + lambda_bytes);
+  }
+
+  std::vector<uint8_t> get_vk_row(vbb_t* vbb, unsigned int idx) {
+    const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+    const uint8_t* row;
+    switch (lambda_bytes) {
+    case 16:
+      row = reinterpret_cast<const uint8_t*>(get_vk_128(vbb, idx));
+      break;
+    case 24:
+      row = reinterpret_cast<const uint8_t*>(get_vk_192(vbb, idx));
+      break;
+    default:
+      row = reinterpret_cast<const uint8_t*>(get_vk_256(vbb, idx));
+      break;
+    }
+    return std::vector<uint8_t>(row, row + lambda_bytes);
+  }
+
+  std::vector<uint8_t> get_row_range(vbb_t* vbb, unsigned int idx, unsigned int len) {
+    const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+    std::vector<uint8_t> rows;
+    switch (lambda_bytes) {
+    case 16: {
+      std::vector<bf128_t> out(len);
+      get_vole_v_128_range(vbb, idx, len, out.data());
+      for (const auto& row : out) {
+        rows.insert(rows.end(), reinterpret_cast<const uint8_t*>(&row),
+                    reinterpret_cast<const uint8_t*>(&row) + lambda_bytes);
+      }
+      break;
+    }
+    case 24: {
+      std::vector<bf192_t> out(len);
+      get_vole_v_192_range(vbb, idx, len, out.data());
+      for (const auto& row : out) {
+        rows.insert(rows.end(), reinterpret_cast<const uint8_t*>(&row),
+                    reinterpret_cast<const uint8_t*>(&row) + lambda_bytes);
+      }
+      break;
+    }
+    default: {
+      std::vector<bf256_t> out(len);
+      get_vole_v_256_range(vbb, idx, len, out.data());
+      for (const auto& row : out) {
+        rows.insert(rows.end(), reinterpret_cast<const uint8_t*>(&row),
+                    reinterpret_cast<const uint8_t*>(&row) + lambda_bytes);
+      }
+      break;
+    }
+    }
+    return rows;
+  }
+
+  struct signer_vbb {
+    signer_vbb(const faest_paramset_t* params, const uint8_t* root_key, const uint8_t* iv,
+               unsigned int len, unsigned int segments, bool prefetch = false,
+               unsigned int checkpoint_level = 0, faest_arena_t* arena = nullptr,
+               bool rows = true) {
+      const unsigned int lambda = params->faest_param.lambda;
+      const unsigned int ell_hat_bytes =
+          (params->faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS) / 8;
+      const vbb_config_t config{static_cast<size_t>(len) * (lambda / 8), segments, prefetch,
+                                checkpoint_level, nullptr, arena};
+
+      c.resize((params->faest_param.tau - 1) * ell_hat_bytes);
+      init_vbb_sign(&vbb, &config, root_key, iv, c.data(), params);
+      prepare_hash_sign(&vbb);
+      if (rows) {
+        prepare_aes_sign(&vbb);
+      }
+    }
+
+    ~signer_vbb() {
+      clean_vbb(&vbb);
+    }
+
+    vbb_t vbb;
+    std::vector<uint8_t> c;
+  };
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(vbb)
+
+BOOST_AUTO_TEST_CASE(test_transpose_row_blocks) {
+  for (unsigned int lambda : {128, 192, 256}) {
+    BOOST_TEST_CONTEXT("lambda: " << lambda) {
+      const unsigned int lambda_bytes = lambda / 8;
+      const unsigned int len          = 24;
+
+      std::vector<uint8_t> blocks(len * lambda_bytes);
+      rand_bytes(blocks.data(), blocks.size());
+      std::vector<uint8_t> rows = blocks;
+      transpose_row_blocks(rows.data(), len, lambda);
+
+      for (unsigned int i = 0; i != len; ++i) {
+        for (unsigned int j = 0; j != lambda; ++j) {
+          BOOST_TEST(ptr_get_bit(&rows[i * lambda_bytes], j) ==
+                     ptr_get_bit(&blocks[(i / 8) * lambda], i % 8 + 8 * j));
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_extract_bits) {
+  for (unsigned int src_bit : {0, 1, 7, 8, 13, 100}) {
+    for (unsigned int nbits : {1, 7, 8, 9, 63, 64, 65, 255, 256, 257, 300, 1000}) {
+      BOOST_TEST_CONTEXT("src_bit: " << src_bit << ", nbits: " << nbits) {
+        // only the bytes holding the bits are available
+        std::vector<uint8_t> src((src_bit + nbits + 7) / 8);
+        rand_bytes(src.data(), src.size());
+        std::vector<uint8_t> dst((nbits + 7) / 8, 0xFF);
+        extract_bits(dst.data(), src.data(), src_bit, nbits);
+
+        for (unsigned int i = 0; i != dst.size() * 8; ++i) {
+          BOOST_TEST(ptr_get_bit(dst.data(), i) ==
+                     (i < nbits ? ptr_get_bit(src.data(), src_bit + i) : 0));
+        }
+      }
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_row_segments, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell        = params.faest_param.l;
+    const unsigned int ell_hat    = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+    signer_vbb single{&params, root_key.data(), iv.data(), ell_hat / 4, 1};
+    signer_vbb segmented{&params, root_key.data(), iv.data(), ell_hat / 4, 2};
+    BOOST_TEST(full.c == single.c);
+    BOOST_TEST(full.c == segmented.c);
+    BOOST_TEST(segmented.vbb.segment_count == 2);
+
+    // alternate between two distant rows ranges that each fit into one segment
+    const uint64_t single_misses    = single.vbb.stats.row_misses;
+    const uint64_t segmented_misses = segmented.vbb.stats.row_misses;
+    for (unsigned int i = 0; i != 4; ++i) {
+      const auto expected_low  = get_row(&full.vbb, i);
+      const auto expected_high = get_row(&full.vbb, ell / 2 + i);
+      BOOST_TEST(get_row(&single.vbb, i) == expected_low);
+      BOOST_TEST(get_row(&single.vbb, ell / 2 + i) == expected_high);
+      BOOST_TEST(get_row(&segmented.vbb, i) == expected_low);
+      BOOST_TEST(get_row(&segmented.vbb, ell / 2 + i) == expected_high);
+    }
+    BOOST_TEST(segmented.vbb.stats.row_misses - segmented_misses <= 2);
+    BOOST_TEST(single.vbb.stats.row_misses - single_misses >= 7);
+
+    // rows beyond the witness are accessed backwards
+    for (unsigned int i = ell + lambda; i-- != ell;) {
+      const auto expected = get_row(&full.vbb, i);
+      BOOST_TEST(get_row(&single.vbb, i) == expected);
+      BOOST_TEST(get_row(&segmented.vbb, i) == expected);
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_row_window_overlap, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell        = params.faest_param.l;
+    const unsigned int ell_hat    = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+    signer_vbb bounded{&params, root_key.data(), iv.data(), ell_hat / 4, 1};
+    const unsigned int window = bounded.vbb.segment_rows;
+
+    // each window starts a few rows before the previous one, so only the new rows are computed,
+    // which takes at most two PRG blocks per leaf
+    const unsigned int first = ell / 4 + 3 * 5;
+    BOOST_TEST(get_row(&bounded.vbb, ell + lambda - 1) == get_row(&full.vbb, ell + lambda - 1));
+    const uint64_t prg_bytes = bounded.vbb.stats.prg_bytes;
+    BOOST_TEST(get_row(&bounded.vbb, first) == get_row(&full.vbb, first));
+    const uint64_t window_prg_bytes = bounded.vbb.stats.prg_bytes - prg_bytes;
+    for (unsigned int i = first; i >= ell / 4; i -= 5) {
+      BOOST_TEST(get_row(&bounded.vbb, i) == get_row(&full.vbb, i));
+      BOOST_TEST(get_row(&bounded.vbb, i + window - 1) == get_row(&full.vbb, i + window - 1));
+    }
+    BOOST_TEST(2 * (bounded.vbb.stats.prg_bytes - prg_bytes - window_prg_bytes) <=
+               3 * window_prg_bytes);
+
+    // rows beyond the witness are accessed backwards, so the windows end a few rows after the
+    // previous one
+    for (unsigned int i = ell + 3; i <= ell + 3 * 4; i += 3) {
+      BOOST_TEST(get_row(&bounded.vbb, i) == get_row(&full.vbb, i));
+      BOOST_TEST(get_row(&bounded.vbb, i - window + 1) == get_row(&full.vbb, i - window + 1));
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_hash_columns, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params    = faest_get_paramset(param_id);
+    const unsigned int lambda        = params.faest_param.lambda;
+    const unsigned int ell_hat       = params.faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+    const unsigned int ell_hat_bytes = (ell_hat + 7) / 8;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    std::vector<uint8_t> expected;
+    {
+      // the full size VOLE is converted to rows by prepare_aes_sign
+      signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1, false, 0, nullptr, false};
+      for (unsigned int i = 0; i != lambda; ++i) {
+        const uint8_t* column = get_vole_v_hash(&full.vbb, i);
+        expected.insert(expected.end(), column, column + ell_hat_bytes);
+      }
+    }
+
+    // streamed from the commitment and recomputed in chunks of one column
+    for (unsigned int len : {ell_hat / 4, ell_hat_bytes / (lambda / 8) + 1}) {
+      signer_vbb bounded{&params, root_key.data(), iv.data(), len, 1};
+      std::pair<std::vector<uint8_t>, unsigned int> columns{{}, ell_hat_bytes};
+      hash_columns_sign(
+          &bounded.vbb,
+          [](void* ctx, const uint8_t* column) {
+            auto* columns = static_cast<std::pair<std::vector<uint8_t>, unsigned int>*>(ctx);
+            columns->first.insert(columns->first.end(), column, column + columns->second);
+          },
+          &columns);
+      BOOST_TEST(columns.first == expected);
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_full_size_rows, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params    = faest_get_paramset(param_id);
+    const unsigned int lambda        = params.faest_param.lambda;
+    const unsigned int ell_hat       = params.faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+    const unsigned int ell_hat_bytes = (ell_hat + 7) / 8;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1, false, 0, nullptr, false};
+    std::vector<uint8_t> columns;
+    for (unsigned int i = 0; i != lambda; ++i) {
+      const uint8_t* column = get_vole_v_hash(&full.vbb, i);
+      columns.insert(columns.end(), column, column + ell_hat_bytes);
+    }
+
+    prepare_aes_sign(&full.vbb);
+    for (unsigned int i = 0; i != ell_hat; ++i) {
+      const auto row = get_row(&full.vbb, i);
+      for (unsigned int j = 0; j != lambda; ++j) {
+        BOOST_TEST(ptr_get_bit(row.data(), j) == ptr_get_bit(&columns[j * ell_hat_bytes], i));
+      }
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_row_range, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell        = params.faest_param.l;
+    const unsigned int ell_hat    = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+    signer_vbb bounded{&params, root_key.data(), iv.data(), ell_hat / 16, 2};
+
+    // ranges crossing window boundaries, both before and beyond the witness
+    for (unsigned int idx : {0u, ell / 2 - 3, ell - 8, ell}) {
+      const unsigned int len = idx < ell ? 8 : lambda;
+      std::vector<uint8_t> expected;
+      for (unsigned int i = 0; i != len; ++i) {
+        const auto row = get_row(&full.vbb, idx + i);
+        expected.insert(expected.end(), row.begin(), row.end());
+      }
+      BOOST_TEST(get_row_range(&full.vbb, idx, len) == expected);
+      BOOST_TEST(get_row_range(&bounded.vbb, idx, len) == expected);
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_row_checkpoint, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell        = params.faest_param.l;
+    const unsigned int ell_hat    = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+    // inner nodes and leaf seeds
+    for (unsigned int level : {3u, static_cast<unsigned int>(MAX_DEPTH)}) {
+      signer_vbb checkpointed{&params, root_key.data(), iv.data(), ell_hat / 8, 1, false, level};
+      BOOST_TEST(checkpointed.vbb.checkpoint.nodes != nullptr);
+      BOOST_TEST(full.c == checkpointed.c);
+
+      for (unsigned int i = 0; i != ell + lambda; ++i) {
+        BOOST_TEST(get_row(&checkpointed.vbb, i) == get_row(&full.vbb, i));
+      }
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_row_prefetch, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell        = params.faest_param.l;
+    const unsigned int ell_hat    = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+    signer_vbb prefetched{&params, root_key.data(), iv.data(), ell_hat / 8, 1, true};
+    BOOST_TEST(full.c == prefetched.c);
+
+    // sequential scan as done by the AES constraints
+    for (unsigned int i = 0; i != ell; ++i) {
+      BOOST_TEST(get_row(&prefetched.vbb, i) == get_row(&full.vbb, i));
+    }
+    if (prefetched.vbb.prefetch) {
+      BOOST_TEST(prefetched.vbb.stats.row_prefetch_hits > 0);
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_row_schedule, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell        = params.faest_param.l;
+    const unsigned int ell_hat    = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+    signer_vbb scheduled{&params, root_key.data(), iv.data(), ell_hat / 8, 2};
+    BOOST_TEST(full.c == scheduled.c);
+    // the key schedule rows are read as recorded
+    BOOST_TEST(scheduled.vbb.schedule != nullptr);
+
+    // accesses deviating from the schedule fall back to LRU
+    for (unsigned int i = 0; i != ell + lambda; ++i) {
+      BOOST_TEST(get_row(&scheduled.vbb, i) == get_row(&full.vbb, i));
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_vk_window, fast_parameters, param_id) {
+  if (param_id == FAEST_EM_128F) {
+    return;
+  }
+
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int nwd        = params.faest_param.Nwd;
+    const unsigned int words      = 4 * (params.faest_param.R + 1);
+    const unsigned int ell_hat    = params.faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+    signer_vbb bounded{&params, root_key.data(), iv.data(), ell_hat / 4, 1};
+
+    // words that are not stored are the sum of the words Nwd and 1 before them
+    const unsigned int step = nwd > 6 ? 4 : nwd;
+    std::vector<std::vector<uint8_t>> expected;
+    for (unsigned int idx = 0; idx != words * 32; ++idx) {
+      expected.emplace_back(get_vk_row(&full.vbb, idx));
+      const unsigned int w = idx / 32;
+      if (w >= nwd && w % step != 0) {
+        std::vector<uint8_t> sum(expected[idx].size());
+        for (unsigned int i = 0; i != sum.size(); ++i) {
+          sum[i] = expected[idx - nwd * 32][i] ^ expected[idx - 32][i];
+        }
+        BOOST_TEST(sum == expected[idx]);
+      }
+    }
+
+    // in order, and restarting the window on accesses before it
+    for (unsigned int idx = 0; idx != words * 32; ++idx) {
+      BOOST_TEST(get_vk_row(&bounded.vbb, idx) == expected[idx]);
+    }
+    for (unsigned int idx = words * 32; idx-- != 0;) {
+      BOOST_TEST(get_vk_row(&bounded.vbb, idx) == expected[idx]);
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_row_arena, fast_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell        = params.faest_param.l;
+    const unsigned int ell_hat    = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+    std::array<uint8_t, MAX_LAMBDA_BYTES> root_key;
+    std::array<uint8_t, IV_SIZE> iv;
+    rand_bytes(root_key.data(), root_key.size());
+    rand_bytes(iv.data(), iv.size());
+
+    signer_vbb full{&params, root_key.data(), iv.data(), ell_hat, 1};
+
+    const unsigned int len = ell_hat / 8;
+    const vbb_config_t config{static_cast<size_t>(len) * (lambda / 8), 1, false, 3, nullptr,
+                              nullptr};
+    faest_arena_t arena;
+    BOOST_TEST_REQUIRE(faest_arena_init(&arena, vbb_arena_bytes(SIGNER, &config, &params)));
+    const auto in_arena = [&arena](const void* ptr) {
+      return static_cast<const uint8_t*>(ptr) >= arena.base &&
+             static_cast<const uint8_t*>(ptr) < arena.base + arena.size;
+    };
+
+    // the arena is reused by consecutive instances
+    for (unsigned int run = 0; run != 2; ++run) {
+      signer_vbb arena_vbb{&params, root_key.data(), iv.data(), len, 1, false, 3, &arena};
+      BOOST_TEST(full.c == arena_vbb.c);
+      BOOST_TEST(in_arena(arena_vbb.vbb.vole_cache));
+      BOOST_TEST(in_arena(arena_vbb.vbb.checkpoint.nodes));
+      BOOST_TEST(in_arena(arena_vbb.vbb.com_hash));
+      for (unsigned int i = 0; i != ell + lambda; ++i) {
+        BOOST_TEST(get_row(&arena_vbb.vbb, i) == get_row(&full.vbb, i));
+      }
+      BOOST_TEST(arena.used <= arena.size);
+    }
+    BOOST_TEST(arena.used == 0);
+    faest_arena_clear(&arena);
+  }
+}
+
+BOOST_DATA_TEST_CASE(test_config_from_budget, all_parameters, param_id) {
+  BOOST_TEST_CONTEXT("Parameter set: " << faest_get_param_name(param_id)) {
+    const faest_paramset_t params = faest_get_paramset(param_id);
+    const unsigned int lambda     = params.faest_param.lambda;
+    const unsigned int ell_hat    = params.faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+    const size_t full_budget      = static_cast<size_t>(ell_hat) * (lambda / 8);
+
+    for (const vbb_tuning_t& tuning : vbb_tunings) {
+      if (tuning.paramid != param_id) {
+        continue;
+      }
+      // budgets between two table entries use the smaller one
+      for (size_t total : {tuning.total_bytes, tuning.total_bytes + lambda / 8}) {
+        const vbb_config_t config = vbb_config_from_budget(total, &params);
+        BOOST_TEST(config.row_segments == tuning.row_segments);
+        BOOST_TEST(config.checkpoint_level == tuning.checkpoint_level);
+        BOOST_TEST(config.max_vole_bytes + vbb_checkpoint_bytes(config.checkpoint_level, &params) ==
+                   total);
+        BOOST_TEST(vbb_row_count_from_budget(config.max_vole_bytes, &params) > 0);
+      }
+    }
+
+    // full budgets and budgets below the table keep the defaults
+    for (size_t total : {full_budget, static_cast<size_t>(lambda / 8)}) {
+      const vbb_config_t config = vbb_config_from_budget(total, &params);
+      BOOST_TEST(config.max_vole_bytes == total);
+      BOOST_TEST(config.row_segments == VBB_DEFAULT_ROW_SEGMENTS);
+      BOOST_TEST(config.checkpoint_level == 0);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
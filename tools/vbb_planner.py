@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+
+"""Offline recompute planner for the row windows of the VBB.
+
+Reads access traces recorded with the vbb_trace tool and computes, for a given memory budget, which
+row windows to recompute on each miss. Windows are placed to cover the longest prefix of the
+upcoming accesses and the window with the furthest next use is evicted (Belady's policy). The
+access sequence of the AES constraints does not depend on the witness, so the resulting schedule
+can be compiled in. The schedules are written to vbb_schedule.h.
+"""
+
+import argparse
+import sys
+from collections import defaultdict
+from fractions import Fraction
+
+PARAMETER_SETS = {
+    "FAEST_128S": (128, 1600),
+    "FAEST_128F": (128, 1600),
+    "FAEST_192S": (192, 3264),
+    "FAEST_192F": (192, 3264),
+    "FAEST_256S": (256, 4000),
+    "FAEST_256F": (256, 4000),
+    "FAEST_EM_128S": (128, 1280),
+    "FAEST_EM_128F": (128, 1280),
+    "FAEST_EM_192S": (192, 2304),
+    "FAEST_EM_192F": (192, 2304),
+    "FAEST_EM_256S": (256, 3584),
+    "FAEST_EM_256F": (256, 3584),
+}
+UNIVERSAL_HASH_B_BITS = 16
+MAX_ROW_SEGMENTS = 8
+
+
+def read_traces(paths):
+    """Return the row accesses of each (parameter set, party) run."""
+    runs = defaultdict(list)
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                if line.startswith("#"):
+                    _, name, party, _ = line.split()
+                    accesses = []
+                    runs[(name, party)].append(accesses)
+                    continue
+                kind, idx = line.split()
+                if kind == "r":
+                    accesses.append(int(idx))
+
+    traces = {}
+    for (name, party), accesses in runs.items():
+        if any(other != accesses[0] for other in accesses[1:]):
+            sys.exit(f"{name} {party}: the row accesses differ between runs")
+        traces[(name, party)] = accesses[0]
+    return traces
+
+
+def row_geometry(name, max_vole_bytes, segments):
+    """Mirror of vbb_row_count_from_budget and setup_row_segments."""
+    lam, ell = PARAMETER_SETS[name]
+    ell_hat = ell + 2 * lam + UNIVERSAL_HASH_B_BITS
+    row_count = min(max_vole_bytes // (lam // 8), ell_hat)
+    if row_count * (lam // 8) < (ell_hat + 7) // 8:
+        return None
+    if row_count >= ell_hat:
+        return None
+    row_blocks = row_count // 8
+    segment_count = max(1, min(segments, MAX_ROW_SEGMENTS, row_blocks))
+    return segment_count, row_blocks // segment_count * 8, ell + lam
+
+
+def window_start(idx, length, ell, lam):
+    """Mirror of row_window_start in vbb.c."""
+    if length >= ell + lam:
+        return 0
+    if idx >= ell:
+        idx = idx + 1 - length if idx + 1 >= length else 0
+    if idx + length > ell + lam:
+        idx = ell + lam - length
+    return idx
+
+
+def simulate_greedy(accesses, segment_count, length, ell, lam):
+    """Number of misses of the LRU policy implemented in vbb.c."""
+    windows = [None] * segment_count
+    last_use = [0] * segment_count
+    misses = 0
+    for clock, idx in enumerate(accesses, 1):
+        for slot, start in enumerate(windows):
+            if start is not None and start <= idx < start + length:
+                last_use[slot] = clock
+                break
+        else:
+            slot = min(range(segment_count), key=lambda s: last_use[s])
+            windows[slot] = window_start(idx, length, ell, lam)
+            last_use[slot] = clock
+            misses += 1
+    return misses
+
+
+def plan_belady(accesses, segment_count, length, limit):
+    """Return the schedule as list of (access number, slot, window start)."""
+    windows = [None] * segment_count
+    schedule = []
+
+    def covered(start, idx):
+        return start is not None and start <= idx < start + length
+
+    for t, idx in enumerate(accesses):
+        if any(covered(start, idx) for start in windows):
+            continue
+
+        # evict the window that is needed again furthest in the future
+        def next_use(slot):
+            start = windows[slot]
+            if start is None:
+                return len(accesses) + 1
+            for u in range(t + 1, len(accesses)):
+                if covered(start, accesses[u]):
+                    return u
+            return len(accesses)
+
+        slot = max(range(segment_count), key=next_use)
+        others = [start for s, start in enumerate(windows) if s != slot]
+
+        # place the window to cover the longest prefix of the upcoming accesses
+        low = high = idx
+        u = t + 1
+        while u < len(accesses):
+            row = accesses[u]
+            if not any(covered(start, row) for start in others):
+                if max(high, row) - min(low, row) + 1 > length:
+                    break
+                low, high = min(low, row), max(high, row)
+            u += 1
+        if u < len(accesses) and accesses[u] < low:
+            start = max(high + 1 - length, 0)
+        else:
+            start = min(low, limit - length)
+
+        windows[slot] = start
+        schedule.append((t, slot, start))
+    return schedule
+
+
+def parse_fraction(value):
+    fraction = Fraction(value)
+    if not 0 < fraction < 1:
+        raise argparse.ArgumentTypeError("budget fractions need to be in (0, 1)")
+    return fraction
+
+
+def full_budget(name):
+    lam, ell = PARAMETER_SETS[name]
+    return (ell + 2 * lam + UNIVERSAL_HASH_B_BITS) * (lam // 8)
+
+
+def write_header(out, schedules):
+    # the s and f variants as well as signer and verifier often share the schedule
+    arrays = {}
+    for _, schedule in schedules:
+        arrays.setdefault(tuple(schedule), len(arrays))
+
+    out.write(
+        """/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+// Generated by tools/vbb_planner.py. Do not edit.
+
+#ifndef VBB_SCHEDULE_H
+#define VBB_SCHEDULE_H
+
+#include "vbb.h"
+
+"""
+    )
+    for schedule, index in arrays.items():
+        out.write(f"static const vbb_schedule_entry_t vbb_schedule_{index}[] = {{\n")
+        for t, slot, start in schedule:
+            out.write(f"    {{{t}, {start}, {slot}}},\n")
+        out.write("};\n\n")
+
+    out.write("static const vbb_schedule_t vbb_schedules[] = {\n")
+    for (name, party, segment_count, length), schedule in schedules:
+        party_id = "SIGNER" if party == "sign" else "VERIFIER"
+        out.write(
+            f"    {{{name}, {party_id}, {segment_count}, {length}, {len(schedule)}, "
+            f"vbb_schedule_{arrays[tuple(schedule)]}}},\n"
+        )
+    out.write("};\n\n#endif\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("traces", nargs="+", help="trace files recorded with vbb_trace")
+    parser.add_argument(
+        "-b",
+        "--budget",
+        type=parse_fraction,
+        action="append",
+        help="budget as fraction of the full VOLE budget (default: 1/2, 1/4, 1/8, 1/16)",
+    )
+    parser.add_argument(
+        "-s",
+        "--segments",
+        type=int,
+        action="append",
+        help="number of row segments (default: 1)",
+    )
+    parser.add_argument("-o", "--output", help="write the schedules to this header")
+    args = parser.parse_args()
+
+    budgets = args.budget or [Fraction(1, 2), Fraction(1, 4), Fraction(1, 8), Fraction(1, 16)]
+    segments = args.segments or [1]
+    traces = read_traces(args.traces)
+
+    schedules = []
+    seen = set()
+    print(f"{'parameter set':<14} {'party':<6} {'budget':>7} {'segs':>4} {'rows':>5} {'LRU':>5} {'plan':>5}")
+    for (name, party), accesses in sorted(traces.items()):
+        lam, ell = PARAMETER_SETS[name]
+        for budget in budgets:
+            max_vole_bytes = int(full_budget(name) * budget)
+            for segment_count in segments:
+                geometry = row_geometry(name, max_vole_bytes, segment_count)
+                if geometry is None:
+                    continue
+                segment_count, length, limit = geometry
+                key = (name, party, segment_count, length)
+                if key in seen:
+                    continue
+                seen.add(key)
+
+                greedy = simulate_greedy(accesses, segment_count, length, ell, lam)
+                schedule = plan_belady(accesses, segment_count, length, limit)
+                print(
+                    f"{name:<14} {party:<6} {str(budget):>7} {segment_count:>4} {length:>5} "
+                    f"{greedy:>5} {len(schedule):>5}"
+                )
+                if len(schedule) < greedy:
+                    schedules.append((key, schedule))
+
+    if args.output:
+        with open(args.output, "w") as out:
+            write_header(out, schedules)
+
+
+if __name__ == "__main__":
+    main()
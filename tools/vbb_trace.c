@@ -0,0 +1,69 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+// Records the VBB access traces of one signing and one verification run of each parameter set.
+// Requires a build with the vbb_trace option. The traces are written to the file given as first
+// argument and can be processed with vbb_planner.py.
+
+#include "faest_128s.h"
+#include "faest_128f.h"
+#include "faest_192s.h"
+#include "faest_192f.h"
+#include "faest_256s.h"
+#include "faest_256f.h"
+#include "faest_em_128s.h"
+#include "faest_em_128f.h"
+#include "faest_em_192s.h"
+#include "faest_em_192f.h"
+#include "faest_em_256s.h"
+#include "faest_em_256f.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define setenv(name, value, overwrite) _putenv_s(name, value)
+#endif
+
+#define TRACE(param, PARAM)                                                                        \
+  do {                                                                                             \
+    uint8_t pk[FAEST_##PARAM##_PUBLIC_KEY_SIZE];                                                   \
+    uint8_t sk[FAEST_##PARAM##_PRIVATE_KEY_SIZE];                                                  \
+    uint8_t sig[FAEST_##PARAM##_SIGNATURE_SIZE];                                                   \
+    size_t siglen = sizeof(sig);                                                                   \
+    if (faest_##param##_keygen(pk, sk) ||                                                          \
+        faest_##param##_sign(sk, message, sizeof(message), sig, &siglen) ||                        \
+        faest_##param##_verify(pk, message, sizeof(message), sig, siglen)) {                       \
+      printf("Tracing FAEST-" #PARAM " failed\n");                                                 \
+      ret = 1;                                                                                     \
+    }                                                                                              \
+  } while (0)
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    printf("Usage: %s trace-file\n", argv[0]);
+    return 1;
+  }
+  if (setenv("FAEST_VBB_TRACE", argv[1], 1)) {
+    printf("Unable to set FAEST_VBB_TRACE\n");
+    return 1;
+  }
+
+  const uint8_t message[32] = {0};
+  int ret                   = 0;
+  TRACE(128s, 128S);
+  TRACE(128f, 128F);
+  TRACE(192s, 192S);
+  TRACE(192f, 192F);
+  TRACE(256s, 256S);
+  TRACE(256f, 256F);
+  TRACE(em_128s, EM_128S);
+  TRACE(em_128f, EM_128F);
+  TRACE(em_192s, EM_192S);
+  TRACE(em_192f, EM_192F);
+  TRACE(em_256s, EM_256S);
+  TRACE(em_256f, EM_256F);
+  return ret;
+}
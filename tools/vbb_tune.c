@@ -0,0 +1,86 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+// Measures the fastest configuration of fractions of the full VOLE budget of each parameter set and
+// writes the results to the file given as first argument, which replaces vbb_tuning.h. The optional
+// second argument sets the number of runs per candidate configuration.
+
+#include "faest_128s.h"
+#include "faest_128f.h"
+#include "faest_192s.h"
+#include "faest_192f.h"
+#include "faest_256s.h"
+#include "faest_256f.h"
+#include "faest_em_128s.h"
+#include "faest_em_128f.h"
+#include "faest_em_192s.h"
+#include "faest_em_192f.h"
+#include "faest_em_256s.h"
+#include "faest_em_256f.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#define TUNE(param, PARAM)                                                                         \
+  do {                                                                                             \
+    for (unsigned int fraction = 2; fraction <= 16; fraction *= 2) {                               \
+      const size_t total = FAEST_##PARAM##_FULL_VOLE_BUDGET / fraction;                            \
+      faest_vbb_tuning_t tuning;                                                                   \
+      if (total < FAEST_##PARAM##_MIN_VOLE_BUDGET) {                                               \
+        break;                                                                                     \
+      }                                                                                            \
+      if (faest_##param##_tune_vole_budget(total, repetitions, &tuning)) {                         \
+        printf("Tuning FAEST-" #PARAM " failed\n");                                                \
+        ret = 1;                                                                                   \
+        break;                                                                                     \
+      }                                                                                            \
+      fprintf(out, "    {FAEST_" #PARAM ", %zu, %u, %u},\n", total, tuning.row_segments,           \
+              tuning.checkpoint_level);                                                            \
+      printf("FAEST-" #PARAM " 1/%u: %u segments, checkpoint level %u\n", fraction,              \
+             tuning.row_segments, tuning.checkpoint_level);                                        \
+      fflush(stdout);                                                                              \
+    }                                                                                              \
+  } while (0)
+
+int main(int argc, char** argv) {
+  if (argc != 2 && argc != 3) {
+    printf("Usage: %s tuning-header [repetitions]\n", argv[0]);
+    return 1;
+  }
+  const unsigned int repetitions = argc == 3 ? (unsigned int)strtoul(argv[2], NULL, 10) : 5;
+  if (!repetitions) {
+    printf("Invalid number of repetitions\n");
+    return 1;
+  }
+
+  FILE* out = fopen(argv[1], "w");
+  if (!out) {
+    printf("Unable to open %s\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(out, "/*\n *  SPDX-License-Identifier: MIT\n */\n\n");
+  fprintf(out, "// Generated by tools/vbb_tune.c. Do not edit.\n\n");
+  fprintf(out, "#ifndef VBB_TUNING_H\n#define VBB_TUNING_H\n\n#include \"vbb.h\"\n\n");
+  fprintf(out, "static const vbb_tuning_t vbb_tunings[] = {\n");
+
+  int ret = 0;
+  TUNE(128s, 128S);
+  TUNE(128f, 128F);
+  TUNE(192s, 192S);
+  TUNE(192f, 192F);
+  TUNE(256s, 256S);
+  TUNE(256f, 256F);
+  TUNE(em_128s, EM_128S);
+  TUNE(em_128f, EM_128F);
+  TUNE(em_192s, EM_192S);
+  TUNE(em_192f, EM_192F);
+  TUNE(em_256s, EM_256S);
+  TUNE(em_256f, EM_256F);
+
+  fprintf(out, "};\n\n#endif\n");
+  fclose(out);
+  return ret;
+}
@@ -1,8 +1,17 @@
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
 #include <stddef.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
 
 #include "macros.h"
+#include "compat.h"
 #include "vbb.h"
 #include "vole.h"
 #include "vc.h"
@@ -11,9 +20,43 @@
 #include "faest_aes.h"
 #include "fields.h"
 #include "parameters.h"
+#include "vbb_schedule.h"
+#include "vbb_tuning.h"
 
 static void setup_vk_cache(vbb_t* vbb);
 
+#if defined(FAEST_VBB_TRACE)
+// Record the accesses of one signing or verification run. The trace is appended to the file named
+// by the FAEST_VBB_TRACE environment variable. Each run starts with a line "# <parameter set>
+// <sign|verify> <rows>" and is followed by one line per access: "h <idx>" for columns used in the
+// hashing phase, "r <idx>" for rows and "k <idx>" for rows of the key schedule.
+static void trace_open(vbb_t* vbb) {
+  const char* path = getenv("FAEST_VBB_TRACE");
+
+  vbb->trace = path ? fopen(path, "a") : NULL;
+  if (vbb->trace) {
+    fprintf(vbb->trace, "# %s %s %u\n", faest_get_param_name(vbb->params->faest_paramid),
+            vbb->party == SIGNER ? "sign" : "verify", vbb->row_count);
+  }
+}
+
+static void trace_access(vbb_t* vbb, char kind, unsigned int idx) {
+  if (vbb->trace) {
+    fprintf(vbb->trace, "%c %u\n", kind, idx);
+  }
+}
+
+static void trace_close(vbb_t* vbb) {
+  if (vbb->trace) {
+    fclose(vbb->trace);
+  }
+}
+#else
+#define trace_open(vbb)
+#define trace_access(vbb, kind, idx)
+#define trace_close(vbb)
+#endif
+
 ATTR_CONST ATTR_ALWAYS_INLINE static inline bool is_em_variant(faest_paramid_t id) {
   return id > 6;
 }
@@ -24,10 +67,46 @@ ATTR_CONST ATTR_ALWAYS_INLINE static inline bool is_column_cached(vbb_t* vbb, un
   return above_cache_start && below_cache_end;
 }
 
-ATTR_CONST ATTR_ALWAYS_INLINE static inline bool is_row_cached(vbb_t* vbb, unsigned int index) {
-  bool above_cache_start = index >= vbb->cache_idx;
-  bool below_cache_end   = index < vbb->cache_idx + vbb->row_count;
-  return above_cache_start && below_cache_end;
+// Place a window of len rows that contains row start. Rows beyond the witness are accessed
+// backwards, hence the window ends at start in that case. Only the first ell + lambda rows are
+// ever accessed.
+ATTR_CONST static unsigned int row_window_start(unsigned int start, unsigned int len,
+                                                unsigned int ell, unsigned int lambda) {
+  if (len >= ell + lambda) {
+    return 0;
+  }
+  if (start >= ell) {
+    start = start + 1 >= len ? start + 1 - len : 0;
+  }
+  if (start + len > ell + lambda) {
+    start = ell + lambda - len;
+  }
+  return start;
+}
+
+// The time of recomputations is only measured if the statistics are requested
+static uint64_t stats_clock(const vbb_t* vbb) {
+  return vbb->stats_out ? faest_monotonic_ns() : 0;
+}
+
+static void stats_add_time(vbb_t* vbb, uint64_t begin) {
+  if (vbb->stats_out) {
+    vbb->stats.recompute_ns += faest_monotonic_ns() - begin;
+  }
+}
+
+static void stats_add(faest_vbb_stats_t* stats, const faest_vbb_stats_t* other) {
+  stats->row_hits += other->row_hits;
+  stats->row_misses += other->row_misses;
+  stats->row_prefetch_hits += other->row_prefetch_hits;
+  stats->column_hits += other->column_hits;
+  stats->column_misses += other->column_misses;
+  stats->row_recomputations += other->row_recomputations;
+  stats->row_reconstructions += other->row_reconstructions;
+  stats->column_recomputations += other->column_recomputations;
+  stats->leaves_expanded += other->leaves_expanded;
+  stats->prg_bytes += other->prg_bytes;
+  stats->recompute_ns += other->recompute_ns;
 }
 
 static void recompute_hash_sign(vbb_t* vbb, unsigned int start, unsigned int end) {
@@ -35,68 +114,453 @@ static void recompute_hash_sign(vbb_t* vbb, unsigned int start, unsigned int end
   const unsigned int ell    = vbb->params->faest_param.l;
   const unsigned int ellhat = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   unsigned int capped_end   = MIN(end, lambda);
+  const uint64_t begin      = stats_clock(vbb);
 
   partial_vole_commit_column(vbb->root_key, vbb->iv, ellhat, start, capped_end,
-                             vole_mode_v(vbb->vole_cache), vbb->params);
+                             vole_mode_v(vbb->vole_cache), vbb->params, &vbb->stats, vbb->arena);
   vbb->cache_idx = start;
+  ++vbb->stats.column_recomputations;
+  stats_add_time(vbb, begin);
+}
+
+static void recompute_vole_row(const vbb_t* vbb, uint8_t* vole_cache, unsigned int start,
+                               unsigned int len, faest_vbb_stats_t* stats,
+                               faest_arena_t* scratch) {
+  const unsigned int lambda = vbb->params->faest_param.lambda;
+
+  partial_vole_commit_row(vbb->root_key, vbb->iv, start, start + len, vbb->params, vole_cache,
+                          vbb->checkpoint.nodes ? &vbb->checkpoint : NULL, stats, scratch);
+  transpose_row_blocks(vole_cache, len, lambda);
+  ++stats->row_recomputations;
+}
+
+static void recompute_vole_row_reconstruct(const vbb_t* vbb, uint8_t* vole_cache,
+                                           unsigned int start, unsigned int len,
+                                           faest_vbb_stats_t* stats, faest_arena_t* scratch);
+
+// Compute the len rows starting at start into vole_cache, len is a multiple of 8. This only reads
+// from vbb and can thus run concurrently with accesses to other windows. The work is counted in
+// stats and the temporary buffers are taken from scratch, which must not be used by a concurrent
+// computation.
+static void recompute_row_window(const vbb_t* vbb, uint8_t* vole_cache, unsigned int start,
+                                 unsigned int len, faest_vbb_stats_t* stats,
+                                 faest_arena_t* scratch) {
+  if (vbb->party == VERIFIER) {
+    recompute_vole_row_reconstruct(vbb, vole_cache, start, len, stats, scratch);
+  } else {
+    recompute_vole_row(vbb, vole_cache, start, len, stats, scratch);
+  }
+}
+
+#if defined(HAVE_PTHREAD)
+// Background computation of the row window following the most recently computed one
+struct vbb_prefetch_t {
+  const vbb_t* vbb;
+  pthread_t thread;
+  bool running;
+  unsigned int start;
+  uint8_t* vole_cache;
+  // Work of the background thread, added to the statistics of vbb when joining it
+  faest_vbb_stats_t stats;
+};
+
+static void* prefetch_worker(void* arg) {
+  struct vbb_prefetch_t* prefetch = arg;
+  recompute_row_window(prefetch->vbb, prefetch->vole_cache, prefetch->start,
+                       prefetch->vbb->segment_rows, &prefetch->stats, NULL);
+  return NULL;
 }
 
-static void recompute_vole_row(vbb_t* vbb, unsigned int start, unsigned int len) {
+static void start_prefetch(vbb_t* vbb, unsigned int start) {
   const unsigned int lambda = vbb->params->faest_param.lambda;
   const unsigned int ell    = vbb->params->faest_param.l;
-  const unsigned int ellhat = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+  vbb_prefetch_t* prefetch  = vbb->prefetch;
 
-  if (start >= ell) {
-    start = start - len + 1;
+  if (start >= ell + lambda) {
+    return;
   }
-  if (len >= ell + lambda) {
-    start = 0;
-  } else if (start + len > ell + lambda) {
-    start = ell + lambda - len;
+  prefetch->start   = row_window_start(start, vbb->segment_rows, ell, lambda);
+  prefetch->running = pthread_create(&prefetch->thread, NULL, prefetch_worker, prefetch) == 0;
+}
+
+static bool finish_prefetch(vbb_t* vbb) {
+  vbb_prefetch_t* prefetch = vbb->prefetch;
+  if (!prefetch || !prefetch->running) {
+    return false;
   }
 
-  partial_vole_commit_row(vbb->root_key, vbb->iv, ellhat, start, start + len, vbb->params,
-                          vbb->vole_cache);
-  vbb->cache_idx = start;
+  pthread_join(prefetch->thread, NULL);
+  prefetch->running = false;
+  stats_add(&vbb->stats, &prefetch->stats);
+  memset(&prefetch->stats, 0, sizeof(prefetch->stats));
+  return true;
+}
+#else
+static bool finish_prefetch(vbb_t* vbb) {
+  (void)vbb;
+  return false;
+}
+#endif
+
+// Allocate a zeroed cache of count rows. The rows are accessed as bf128_t, bf192_t or bf256_t,
+// hence the cache is aligned for the largest of them.
+static uint8_t* alloc_row_cache(faest_arena_t* arena, unsigned int count,
+                                unsigned int lambda_bytes) {
+  const size_t size = faest_arena_bytes((size_t)count * lambda_bytes);
+  uint8_t* cache    = faest_arena_alloc(arena, size);
+  memset(cache, 0, size);
+  return cache;
+}
+
+static uint8_t* alloc_com_hash(faest_arena_t* arena) {
+  uint8_t* com_hash = faest_arena_alloc(arena, MAX_LAMBDA_BYTES * 2);
+  memset(com_hash, 0, MAX_LAMBDA_BYTES * 2);
+  return com_hash;
+}
+
+static void setup_stats(vbb_t* vbb, const vbb_config_t* config) {
+  memset(&vbb->stats, 0, sizeof(vbb->stats));
+  vbb->stats_out = config->stats;
+}
+
+// Allocate the checkpoint of the GGM trees. It only pays off if rows are recomputed.
+static bool setup_checkpoint(vbb_t* vbb, const vbb_config_t* config) {
+  vbb->checkpoint.level = config->checkpoint_level;
+  vbb->checkpoint.nodes = NULL;
+  if (vbb->full_size || !config->checkpoint_level) {
+    return false;
+  }
+
+  vbb->checkpoint.nodes =
+      faest_arena_alloc(vbb->arena, vbb_checkpoint_bytes(config->checkpoint_level, vbb->params));
+  return vbb->checkpoint.nodes != NULL;
+}
+
+// Look up the precomputed window placement for the parameter set and segment geometry.
+static const vbb_schedule_t* find_schedule(const vbb_t* vbb) {
+  for (size_t i = 0; i < sizeof(vbb_schedules) / sizeof(vbb_schedules[0]); ++i) {
+    const vbb_schedule_t* schedule = &vbb_schedules[i];
+    if (schedule->paramid == vbb->params->faest_paramid && schedule->party == vbb->party &&
+        schedule->segment_count == vbb->segment_count &&
+        schedule->segment_rows == vbb->segment_rows) {
+      return schedule;
+    }
+  }
+  return NULL;
+}
+
+// Return the segment to replace on the current miss according to the schedule. The schedule is
+// dropped if the accesses deviate from the recorded ones.
+static vbb_row_segment_t* scheduled_segment(vbb_t* vbb, unsigned int idx, unsigned int access,
+                                            unsigned int* start) {
+  const vbb_schedule_t* schedule = vbb->schedule;
+  if (!schedule) {
+    return NULL;
+  }
+
+  if (vbb->schedule_pos < schedule->len) {
+    const vbb_schedule_entry_t* entry = &schedule->entries[vbb->schedule_pos];
+    if (entry->access == access && idx >= entry->start &&
+        idx < entry->start + vbb->segment_rows) {
+      ++vbb->schedule_pos;
+      *start = entry->start;
+      return &vbb->segments[entry->segment];
+    }
+  }
+  vbb->schedule = NULL;
+  return NULL;
+}
+
+// Split the RMO cache into segments of equal size. In full size mode, a single segment holds all
+// rows. If prefetching is enabled, an additional window is reserved for the prefetched rows.
+// Windows are computed in blocks of 8 rows, hence the segments hold a multiple of 8 rows.
+static void setup_row_segments(vbb_t* vbb, const vbb_config_t* config) {
+  const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+  const unsigned int row_blocks   = vbb->row_count / 8;
+
+  vbb->prefetch      = NULL;
+  vbb->segment_count = vbb->full_size
+                           ? 1
+                           : MAX(1, MIN(MIN(config->row_segments, VBB_MAX_ROW_SEGMENTS),
+                                        row_blocks));
+#if defined(HAVE_PTHREAD)
+  if (config->prefetch && !vbb->full_size && row_blocks > vbb->segment_count) {
+    vbb->prefetch = calloc(1, sizeof(vbb_prefetch_t));
+  }
+#endif
+  vbb->segment_rows =
+      vbb->full_size ? vbb->row_count
+                     : row_blocks / (vbb->segment_count + (vbb->prefetch ? 1 : 0)) * 8;
+  vbb->schedule          = vbb->full_size || vbb->prefetch ? NULL : find_schedule(vbb);
+  vbb->row_clock         = 0;
+  for (unsigned int i = 0; i < vbb->segment_count; ++i) {
+    vbb->segments[i].start      = 0;
+    vbb->segments[i].last_use   = 0;
+    vbb->segments[i].vole_cache = vbb->vole_cache + (size_t)i * vbb->segment_rows * lambda_bytes;
+  }
+#if defined(HAVE_PTHREAD)
+  if (vbb->prefetch) {
+    vbb->prefetch->vbb = vbb;
+    vbb->prefetch->vole_cache =
+        vbb->vole_cache + (size_t)vbb->segment_count * vbb->segment_rows * lambda_bytes;
+  }
+#endif
+}
+
+// Replace the column-major full size VOLE by its rows, which are then served like the rows of a
+// window. The bytes of the columns are gathered into blocks of 8 rows, which are transposed at once.
+static void transpose_full_size(vbb_t* vbb) {
+  const unsigned int lambda        = vbb->params->faest_param.lambda;
+  const unsigned int lambda_bytes  = lambda / 8;
+  const unsigned int ell_hat       = vbb->row_count;
+  const unsigned int ell_hat_bytes = ell_hat / 8;
+
+  uint8_t* rows = faest_arena_alloc(vbb->arena, faest_arena_bytes((size_t)ell_hat * lambda_bytes));
+  for (unsigned int column = 0; column != lambda; ++column) {
+    const uint8_t* src = vbb->vole_cache + (size_t)column * ell_hat_bytes;
+    for (unsigned int block = 0; block != ell_hat_bytes; ++block) {
+      rows[(size_t)block * lambda + column] = src[block];
+    }
+  }
+  transpose_row_blocks(rows, ell_hat, lambda);
+
+  faest_arena_free(vbb->arena, vbb->vole_cache);
+  vbb->vole_cache             = rows;
+  vbb->segments[0].vole_cache = rows;
+}
+
+// Drop all cached rows, e.g., after the cache has been used for columns.
+static void reset_row_segments(vbb_t* vbb) {
+  finish_prefetch(vbb);
+  for (unsigned int i = 0; i < vbb->segment_count; ++i) {
+    vbb->segments[i].last_use = 0;
+  }
+  vbb->schedule_pos = 0;
+  vbb->row_accesses = 0;
+  if (vbb->full_size) {
+    vbb->segments[0].last_use = ++vbb->row_clock;
+  }
+}
+
+// Move the window of segment to start. If the segment holds rows of the new window, they are moved
+// into place and only the other rows are computed, rounded up to blocks of 8 rows.
+static void move_row_window(vbb_t* vbb, vbb_row_segment_t* segment, bool cached,
+                            unsigned int start) {
+  const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+  const unsigned int len          = vbb->segment_rows;
+  const unsigned int old_start    = segment->start;
+  uint8_t* vole_cache             = segment->vole_cache;
+
+  segment->start = start;
+  if (!cached || start + len <= old_start || old_start + len <= start) {
+    recompute_row_window(vbb, vole_cache, start, len, &vbb->stats, vbb->arena);
+    return;
+  }
+
+  if (start >= old_start) {
+    // keep the end of the old window and compute the rows after it
+    const unsigned int fresh = (start - old_start + 7) / 8 * 8;
+    memmove(vole_cache, vole_cache + (size_t)(start - old_start) * lambda_bytes,
+            (size_t)(len - fresh) * lambda_bytes);
+    if (fresh) {
+      recompute_row_window(vbb, vole_cache + (size_t)(len - fresh) * lambda_bytes,
+                           start + len - fresh, fresh, &vbb->stats, vbb->arena);
+    }
+  } else {
+    // keep the start of the old window and compute the rows before it
+    const unsigned int fresh = (old_start - start + 7) / 8 * 8;
+    memmove(vole_cache + (size_t)fresh * lambda_bytes,
+            vole_cache + (size_t)(start + fresh - old_start) * lambda_bytes,
+            (size_t)(len - fresh) * lambda_bytes);
+    recompute_row_window(vbb, vole_cache, start, fresh, &vbb->stats, vbb->arena);
+  }
+}
+
+// Return the segment holding row idx. On a miss, the segment and window given by the schedule or
+// otherwise the least recently used segment is recomputed.
+static const vbb_row_segment_t* get_row_segment(vbb_t* vbb, unsigned int idx) {
+  const unsigned int lambda = vbb->params->faest_param.lambda;
+  const unsigned int ell    = vbb->params->faest_param.l;
+  const unsigned int access = vbb->row_accesses++;
+  vbb_row_segment_t* lru    = &vbb->segments[0];
+
+  ++vbb->row_clock;
+  for (unsigned int i = 0; i < vbb->segment_count; ++i) {
+    vbb_row_segment_t* segment = &vbb->segments[i];
+    if (segment->last_use && idx >= segment->start && idx < segment->start + vbb->segment_rows) {
+      segment->last_use = vbb->row_clock;
+      ++vbb->stats.row_hits;
+      return segment;
+    }
+    if (segment->last_use < lru->last_use) {
+      lru = segment;
+    }
+  }
+
+#if defined(HAVE_PTHREAD)
+  vbb_prefetch_t* prefetch = vbb->prefetch;
+  if (prefetch) {
+    const bool cached = lru->last_use != 0;
+    lru->last_use     = vbb->row_clock;
+    if (prefetch->running && idx >= prefetch->start &&
+        idx < prefetch->start + vbb->segment_rows) {
+      // swap in the prefetched window
+      finish_prefetch(vbb);
+      uint8_t* vole_cache  = lru->vole_cache;
+      lru->vole_cache      = prefetch->vole_cache;
+      lru->start           = prefetch->start;
+      prefetch->vole_cache = vole_cache;
+      ++vbb->stats.row_prefetch_hits;
+    } else {
+      const uint64_t begin = stats_clock(vbb);
+      move_row_window(vbb, lru, cached, row_window_start(idx, vbb->segment_rows, ell, lambda));
+      finish_prefetch(vbb);
+      stats_add_time(vbb, begin);
+      ++vbb->stats.row_misses;
+    }
+    start_prefetch(vbb, lru->start + vbb->segment_rows);
+    return lru;
+  }
+#endif
+
+  ++vbb->stats.row_misses;
+  unsigned int start;
+  vbb_row_segment_t* segment = scheduled_segment(vbb, idx, access, &start);
+  if (!segment) {
+    segment = lru;
+    start   = row_window_start(idx, vbb->segment_rows, ell, lambda);
+  }
+  const bool cached    = segment->last_use != 0;
+  segment->last_use    = vbb->row_clock;
+  const uint64_t begin = stats_clock(vbb);
+  move_row_window(vbb, segment, cached, start);
+  stats_add_time(vbb, begin);
+  return segment;
+}
+
+unsigned int vbb_row_count_from_budget(size_t max_vole_bytes, const faest_paramset_t* params) {
+  const unsigned int lambda       = params->faest_param.lambda;
+  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int ellhat       = params->faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+  const unsigned int ellhat_bytes = (ellhat + 7) / 8;
+
+  const size_t row_count = max_vole_bytes / lambda_bytes;
+  if (row_count >= ellhat) {
+    return ellhat;
+  }
+  // the hash phase needs to hold at least one full column
+  if (row_count * lambda_bytes < ellhat_bytes) {
+    return 0;
+  }
+  return row_count;
+}
+
+size_t vbb_arena_bytes(party_t party, const vbb_config_t* config, const faest_paramset_t* params) {
+  const unsigned int lambda       = params->faest_param.lambda;
+  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int ellhat       = params->faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+  const unsigned int ellhat_bytes = (ellhat + 7) / 8;
+  const unsigned int row_count    = vbb_row_count_from_budget(config->max_vole_bytes, params);
+
+  size_t bytes = faest_arena_bytes(MAX_LAMBDA_BYTES * 2) +
+                 faest_arena_bytes((size_t)row_count * lambda_bytes);
+  bytes += party == SIGNER ? faest_arena_bytes(ellhat_bytes)
+                           : faest_arena_bytes(lambda_bytes + UNIVERSAL_HASH_B) +
+                                 2 * faest_arena_bytes(lambda);
+  if (!is_em_variant(params->faest_paramid)) {
+    const unsigned int nwd = params->faest_param.Nwd;
+    bytes += row_count < ellhat
+                 ? faest_arena_bytes((size_t)params->faest_param.Lke * lambda_bytes) +
+                       faest_arena_bytes((size_t)nwd * 32 * lambda_bytes)
+                 : faest_arena_bytes((size_t)(params->faest_param.R + 1) * 128 * lambda_bytes);
+  }
+  if (row_count < ellhat) {
+    bytes += faest_arena_bytes(vbb_checkpoint_bytes(config->checkpoint_level, params));
+  } else {
+    // The row-major copy of the full size VOLE
+    bytes += faest_arena_bytes((size_t)ellhat * lambda_bytes);
+  }
+  // Scratch space of the VOLE functions, the opened trees and the truncated correction values
+  bytes += vole_scratch_bytes(config->checkpoint_level, params) +
+           faest_arena_bytes(params->faest_param.tau * lambda_bytes) +
+           faest_arena_bytes(ellhat_bytes);
+  return bytes;
+}
+
+size_t vbb_checkpoint_bytes(unsigned int level, const faest_paramset_t* params) {
+  return level ? vole_checkpoint_nodes(level, params) * (params->faest_param.lambda / 8) : 0;
+}
+
+vbb_config_t vbb_config_from_budget(size_t total_bytes, const faest_paramset_t* params) {
+  const unsigned int lambda = params->faest_param.lambda;
+  const unsigned int ellhat = params->faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+  vbb_config_t config = {total_bytes, VBB_DEFAULT_ROW_SEGMENTS, false, 0, NULL, NULL};
+  if (vbb_row_count_from_budget(total_bytes, params) >= ellhat) {
+    return config;
+  }
+
+  const vbb_tuning_t* best = NULL;
+  for (size_t i = 0; i < sizeof(vbb_tunings) / sizeof(vbb_tunings[0]); ++i) {
+    const vbb_tuning_t* tuning = &vbb_tunings[i];
+    if (tuning->paramid == params->faest_paramid && tuning->total_bytes <= total_bytes &&
+        (!best || tuning->total_bytes > best->total_bytes)) {
+      best = tuning;
+    }
+  }
+  if (best) {
+    config.max_vole_bytes   = total_bytes - vbb_checkpoint_bytes(best->checkpoint_level, params);
+    config.row_segments     = best->row_segments;
+    config.checkpoint_level = best->checkpoint_level;
+  }
+  return config;
 }
 
-// len is the number of OLE v's that is allowed to be stored in memory.
-// Hence we store (at most) len*lambda in memory.
-void init_vbb_sign(vbb_t* vbb, unsigned int len, const uint8_t* root_key, const uint8_t* iv,
-                   uint8_t* c, const faest_paramset_t* params) {
+// row_count is the number of OLE v's that is allowed to be stored in memory.
+// Hence we store (at most) row_count*lambda in memory.
+void init_vbb_sign(vbb_t* vbb, const vbb_config_t* config, const uint8_t* root_key,
+                   const uint8_t* iv, uint8_t* c, const faest_paramset_t* params) {
   const unsigned int lambda       = params->faest_param.lambda;
   const unsigned int lambda_bytes = lambda / 8;
   const unsigned int ellhat       = params->faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   const unsigned int ellhat_bytes = (ellhat + 7) / 8;
-  const unsigned int row_count    = len;
+  const unsigned int row_count    = vbb_row_count_from_budget(config->max_vole_bytes, params);
   const unsigned int column_count = (size_t)row_count * (size_t)lambda_bytes / (size_t)ellhat_bytes;
   assert(column_count >= 1);
 
-  vbb->party        = SIGNER;
+  vbb->party = SIGNER;
+  vbb->arena = config->arena;
+  faest_arena_reset(vbb->arena, 0);
   vbb->iv           = iv;
-  vbb->com_hash     = calloc(MAX_LAMBDA_BYTES * 2, sizeof(uint8_t));
+  vbb->com_hash     = alloc_com_hash(vbb->arena);
   vbb->params       = params;
   vbb->root_key     = root_key;
-  vbb->full_size    = len >= ellhat;
-  vbb->vole_U       = malloc(ellhat_bytes);
+  vbb->full_size    = row_count >= ellhat;
+  vbb->vole_U       = faest_arena_alloc(vbb->arena, ellhat_bytes);
   vbb->row_count    = row_count;
-  vbb->vole_cache   = calloc(row_count, lambda_bytes);
-  vbb->v_buf        = malloc(lambda_bytes);
+  vbb->vole_cache   = alloc_row_cache(vbb->arena, row_count, lambda_bytes);
+  vbb->vk_cache     = NULL;
+  vbb->vk_words     = NULL;
   vbb->column_count = column_count;
+  setup_stats(vbb, config);
+  setup_row_segments(vbb, config);
+  trace_open(vbb);
 
-  // Setup vk_buf if we are not in an EM variant
-  if (!is_em_variant(vbb->params->faest_paramid)) {
-    vbb->vk_buf = malloc(lambda_bytes);
-  }
 
   sign_vole_mode_ctx_t mode =
       vbb->full_size ? vole_mode_all_sign(vbb->vole_cache, vbb->vole_U, vbb->com_hash, c)
                      : vole_mode_u_hcom_c(vbb->vole_U, vbb->com_hash, c);
 
-  partial_vole_commit_column(vbb->root_key, vbb->iv, ellhat, 0, lambda, mode, vbb->params);
+  partial_vole_commit_column(vbb->root_key, vbb->iv, ellhat, 0, lambda, mode, vbb->params,
+                             &vbb->stats, vbb->arena);
+  if (setup_checkpoint(vbb, config)) {
+    vole_checkpoint_commit(&vbb->checkpoint, vbb->root_key, vbb->iv, vbb->params, vbb->arena);
+  }
 }
 
 void prepare_hash_sign(vbb_t* vbb) {
+  // the row windows share the cache with the columns
+  finish_prefetch(vbb);
   if (vbb->full_size) {
     vbb->cache_idx = 0;
     return;
@@ -104,12 +568,39 @@ void prepare_hash_sign(vbb_t* vbb) {
   recompute_hash_sign(vbb, 0, vbb->column_count);
 }
 
+void hash_columns_sign(vbb_t* vbb, vole_column_fn fn, void* ctx) {
+  const unsigned int lambda = vbb->params->faest_param.lambda;
+  const unsigned int ellhat = vbb->params->faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+
+  // the columns are only read once, so stream them tree by tree if the cache holds one tree
+  finish_prefetch(vbb);
+  if (!vbb->full_size &&
+      vbb->column_count >= MAX(vbb->params->faest_param.k0, vbb->params->faest_param.k1)) {
+    for (unsigned int i = 0; i != lambda; ++i) {
+      trace_access(vbb, 'h', i);
+    }
+    const uint64_t begin = stats_clock(vbb);
+    partial_vole_commit_column(vbb->root_key, vbb->iv, ellhat, 0, lambda,
+                               vole_mode_v_stream(vbb->vole_cache, fn, ctx), vbb->params,
+                               &vbb->stats, vbb->arena);
+    // nothing is cached afterwards
+    vbb->cache_idx = lambda;
+    ++vbb->stats.column_recomputations;
+    stats_add_time(vbb, begin);
+    return;
+  }
+
+  prepare_hash_sign(vbb);
+  for (unsigned int i = 0; i != lambda; ++i) {
+    fn(ctx, get_vole_v_hash(vbb, i));
+  }
+}
+
 void prepare_aes_sign(vbb_t* vbb) {
   if (vbb->full_size) {
-    vbb->cache_idx = 0;
-  } else {
-    recompute_vole_row(vbb, 0, vbb->row_count);
+    transpose_full_size(vbb);
   }
+  reset_row_segments(vbb);
   if (!is_em_variant(vbb->params->faest_paramid)) {
     setup_vk_cache(vbb);
   }
@@ -120,13 +611,15 @@ void vector_open_ondemand(vbb_t* vbb, unsigned int idx, const uint8_t* s_, uint8
   const unsigned int lambda       = vbb->params->faest_param.lambda;
   const unsigned int lambda_bytes = lambda / 8;
   const unsigned int tau          = vbb->params->faest_param.tau;
-  uint8_t* expanded_keys          = malloc(tau * lambda_bytes);
+  const size_t mark               = faest_arena_mark(vbb->arena);
+  uint8_t* expanded_keys          = faest_arena_alloc(vbb->arena, tau * lambda_bytes);
   prg(vbb->root_key, vbb->iv, expanded_keys, lambda, lambda_bytes * tau);
 
   vec_com_t vec_com;
   vector_commitment(expanded_keys + lambda_bytes * idx, lambda, depth, NULL, &vec_com);
   vector_open(&vec_com, s_, sig_pdec, sig_com, depth, vbb->iv, lambda);
-  free(expanded_keys);
+  faest_arena_free(vbb->arena, expanded_keys);
+  faest_arena_reset(vbb->arena, mark);
 }
 
 static inline void apply_correction_values_column(vbb_t* vbb, unsigned int start,
@@ -137,11 +630,9 @@ static inline void apply_correction_values_column(vbb_t* vbb, unsigned int start
   const unsigned int ell_hat_bytes = (ell_hat + 7) / 8;
   const unsigned int tau           = vbb->params->faest_param.tau;
   const unsigned int tau0          = vbb->params->faest_param.t0;
-  const unsigned int tau1          = vbb->params->faest_param.t1;
   const unsigned int k0            = vbb->params->faest_param.k0;
   const unsigned int k1            = vbb->params->faest_param.k1;
 
-  const uint8_t* chall3 = dsignature_chall_3(vbb->sig, vbb->params);
   const uint8_t* c      = dsignature_c(vbb->sig, 0, vbb->params);
   unsigned int col_idx  = k0;
   vbb->cache_idx = start;
@@ -154,8 +645,6 @@ static inline void apply_correction_values_column(vbb_t* vbb, unsigned int start
     if (col_idx >= start + len) {
       break;
     }
-    uint8_t delta[MAX_DEPTH];
-    ChalDec(chall3, i, k0, tau0, k1, tau1, delta);
 
     for (unsigned int d = 0; d < depth; d++, col_idx++) {
       if (start > col_idx) {
@@ -163,7 +652,8 @@ static inline void apply_correction_values_column(vbb_t* vbb, unsigned int start
       }
       masked_xor_u8_array(
           vbb->vole_cache + (col_idx - start) * ell_hat_bytes, c + (i - 1) * ell_hat_bytes,
-          vbb->vole_cache + (col_idx - start) * ell_hat_bytes, delta[d], ell_hat_bytes);
+          vbb->vole_cache + (col_idx - start) * ell_hat_bytes, vbb->delta_bits[col_idx],
+          ell_hat_bytes);
 
       if (col_idx + 1 >= start + len) {
         return;
@@ -172,7 +662,20 @@ static inline void apply_correction_values_column(vbb_t* vbb, unsigned int start
   }
 }
 
-static void setup_pdec_com(vbb_t* vbb, const uint8_t** pdec, const uint8_t** com) {
+// Decodes chall_3 once for all trees, the column index i is the bit index in chall_3
+static void setup_delta(vbb_t* vbb) {
+  const unsigned int lambda = vbb->params->faest_param.lambda;
+  const uint8_t* chall3     = dsignature_chall_3(vbb->sig, vbb->params);
+
+  vbb->delta_bits  = faest_arena_alloc(vbb->arena, lambda);
+  vbb->delta_masks = faest_arena_alloc(vbb->arena, lambda);
+  for (unsigned int i = 0; i < lambda; ++i) {
+    vbb->delta_bits[i]  = ptr_get_bit(chall3, i);
+    vbb->delta_masks[i] = -vbb->delta_bits[i];
+  }
+}
+
+static void setup_pdec_com(const vbb_t* vbb, const uint8_t** pdec, const uint8_t** com) {
   const unsigned int tau = vbb->params->faest_param.tau;
   for (unsigned int i = 0; i < tau; ++i) {
     pdec[i] = dsignature_pdec(vbb->sig, i, vbb->params);
@@ -187,111 +690,64 @@ static void recompute_hash_verify(vbb_t* vbb, unsigned int start, unsigned int l
   const unsigned int ell_hat = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   const unsigned int amount  = MIN(len, lambda - start);
   const uint8_t* chall3      = dsignature_chall_3(vbb->sig, vbb->params);
+  const uint64_t begin       = stats_clock(vbb);
 
   const uint8_t* pdec[MAX_TAU];
   const uint8_t* com[MAX_TAU];
   setup_pdec_com(vbb, pdec, com);
 
   partial_vole_reconstruct_column(vbb->iv, chall3, pdec, com, ell_hat, start, amount,
-                                  vole_mode_q(vbb->vole_cache), vbb->params);
+                                  vole_mode_q(vbb->vole_cache), vbb->params, &vbb->stats,
+                                  vbb->arena);
   apply_correction_values_column(vbb, start, amount);
   vbb->cache_idx = start;
+  ++vbb->stats.column_recomputations;
+  stats_add_time(vbb, begin);
 }
 
-static void apply_correction_values_row(vbb_t* vbb, unsigned int start, unsigned int len) {
+static void apply_correction_values_row(const vbb_t* vbb, uint8_t* q, unsigned int start,
+                                        unsigned int len, faest_arena_t* scratch) {
   const unsigned int lambda        = vbb->params->faest_param.lambda;
   const unsigned int ell           = vbb->params->faest_param.l;
   const unsigned int tau           = vbb->params->faest_param.tau;
   const unsigned int ell_hat       = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   const unsigned int ell_hat_bytes = ell_hat / 8;
   const unsigned int tau0          = vbb->params->faest_param.t0;
-  const unsigned int tau1          = vbb->params->faest_param.t1;
   const unsigned int k0            = vbb->params->faest_param.k0;
   const unsigned int k1            = vbb->params->faest_param.k1;
-  const uint8_t* chall3            = dsignature_chall_3(vbb->sig, vbb->params);
   const uint8_t* c                 = dsignature_c(vbb->sig, 0, vbb->params);
   const unsigned int len_bytes = (len + 7) / 8;
 
-  uint8_t* c_trunc      = malloc(len_bytes);
-  uint8_t* c_trunc_mask = malloc(len_bytes);
-  
+  const size_t mark             = faest_arena_mark(scratch);
+  uint8_t* c_trunc              = faest_arena_alloc(scratch, len_bytes);
+
   unsigned long col_idx  = k0;
   for (unsigned int i = 1; i < tau; i++) {
     const unsigned int depth = i < tau0 ? k0 : k1;
 
-    uint8_t delta[MAX_DEPTH];
-    ChalDec(chall3, i, k0, tau0, k1, tau1, delta);
     // Make a c_trunc
-    const uint8_t* c_ptr = c + (i - 1) * ell_hat_bytes;
-
-    unsigned int bit_offset = start % 8;
-    unsigned int start_byte = start / 8;
-    // If aligned, copy over
-    if (bit_offset == 0) {
-      memcpy(c_trunc, c_ptr + start_byte, len_bytes);
-    } else { // If not aligned
-      for (unsigned int j = 0; j < len_bytes; j++) {
-        c_trunc[j] =
-            (c_ptr[start_byte + j] >> bit_offset) | (c_ptr[start_byte + j + 1] << (8 - bit_offset));
-      }
-      // Get last part
-      c_trunc[len_bytes - 1] = (c_ptr[start_byte + len_bytes - 1] >> bit_offset);
-      unsigned int rest      = len - (len_bytes - 1) * 8;
-      if (rest > 8 - bit_offset) {
-        // Get extra part
-        c_trunc[len_bytes - 1] |= c_ptr[start_byte + len_bytes] << (8 - bit_offset);
-      }
-    }
-    // Clear final bits
-    unsigned int bits_to_clear = (8 - (len % 8)) % 8;
-    c_trunc[len_bytes - 1] &= (uint8_t)0xFF >> bits_to_clear;
+    extract_bits(c_trunc, c + (i - 1) * ell_hat_bytes, start, len);
 
     for (unsigned int d = 0; d < depth; d++) {
-      // TODO: if delta[d] == 0 continue; else mask = 0xFF
-      uint8_t mask = -(delta[d] & 1);
-      for(unsigned int k = 0; k < len_bytes; k++) {
-        c_trunc_mask[k] = c_trunc[k] & mask;
-      }
-
-      uint8_t* q = vbb->vole_cache;
-      
-      // Shift offset and XOR into v
-      unsigned long row_bit_index   = (unsigned long)len * (col_idx);
-      unsigned long row_bit_offset  = row_bit_index % 8;
-      unsigned long row_byte_offset = row_bit_index / 8;
-      // Apply first byte
-      q[row_byte_offset] ^= c_trunc_mask[0] << row_bit_offset;
-      // Apply the remaining
-      for (unsigned int k = 1; k < len_bytes; k++) {
-        q[row_byte_offset + k] ^=
-            (c_trunc_mask[k - 1] >> (8 - row_bit_offset)) | (c_trunc_mask[k] << row_bit_offset);
-      }
-
-      if (row_bit_offset != 0) {
-        q[row_byte_offset + len_bytes] ^= c_trunc_mask[len_bytes - 1] >> (8 - row_bit_offset);
+      // XOR c_trunc * delta into the blocks of 8 rows
+      const uint8_t mask = vbb->delta_masks[col_idx];
+      for (unsigned int k = 0; k < len_bytes; k++) {
+        q[k * lambda + col_idx] ^= c_trunc[k] & mask;
       }
       col_idx++;
     }
 
   }
-  free(c_trunc);
-  free(c_trunc_mask);
-
-  vbb->cache_idx = start;
+  faest_arena_free(scratch, c_trunc);
+  faest_arena_reset(scratch, mark);
 }
 
-static void apply_witness_values_row(vbb_t* vbb, unsigned int start, unsigned int len) {
+static void apply_witness_values_row(const vbb_t* vbb, uint8_t* q, unsigned int start,
+                                     unsigned int len, faest_arena_t* scratch) {
+  const unsigned int lambda       = vbb->params->faest_param.lambda;
   const unsigned int ell          = vbb->params->faest_param.l;
-  const unsigned int tau          = vbb->params->faest_param.tau;
-  const unsigned int tau0         = vbb->params->faest_param.t0;
-  const unsigned int tau1         = vbb->params->faest_param.t1;
-  const unsigned int k0           = vbb->params->faest_param.k0;
-  const unsigned int k1           = vbb->params->faest_param.k1;
   const uint8_t* d_ptr            = dsignature_d(vbb->sig, vbb->params);
-  const uint8_t* chall3           = dsignature_chall_3(vbb->sig, vbb->params);
-  unsigned int col_idx            = 0;
   unsigned int effective_len      = MIN(len, ell - start);
-  uint8_t delta[MAX_DEPTH];
 
   if(start >= ell){
     return;
@@ -299,147 +755,84 @@ static void apply_witness_values_row(vbb_t* vbb, unsigned int start, unsigned in
   
   // Make d_trunc
   const unsigned int len_bytes  = (effective_len + 7) / 8;
-  uint8_t* d_trunc              = malloc(len_bytes);
-  uint8_t* d_trunc_mask         = malloc(len_bytes);
-
-  unsigned int bit_offset = start % 8;
-  unsigned int start_byte = start / 8;
-  // If aligned, copy over
-  if (bit_offset == 0) {
-    memcpy(d_trunc, d_ptr + start_byte, len_bytes);
-  } else { // If not aligned
-    for (unsigned int j = 0; j < len_bytes; j++) {
-      d_trunc[j] =
-          (d_ptr[start_byte + j] >> bit_offset) | (d_ptr[start_byte + j + 1] << (8 - bit_offset));
-    }
-    // Get last part
-    d_trunc[len_bytes - 1] = (d_ptr[start_byte + len_bytes - 1] >> bit_offset);
-    unsigned int rest      = effective_len - (len_bytes - 1) * 8;
-    if (rest > 8 - bit_offset) {
-      // Get extra part
-      d_trunc[len_bytes - 1] |= d_ptr[start_byte + len_bytes] << (8 - bit_offset);
-    }
-  }
-  // Clear final bits
-  unsigned int bits_to_clear = (8 - (effective_len % 8)) % 8;
-  d_trunc[len_bytes - 1] &= (uint8_t)0xFF >> bits_to_clear;
-
-  for (unsigned int t = 0; t < tau; t++) {
-    unsigned int depth = t < tau0 ? k0 : k1;
-    ChalDec(chall3, t, k0, tau0, k1, tau1, delta);
+  const size_t mark             = faest_arena_mark(scratch);
+  uint8_t* d_trunc              = faest_arena_alloc(scratch, len_bytes);
 
-    for (unsigned int d = 0; d < depth; d++) {
-      // Mul d_truct with delta[d] store in d_trunc_mask
-      uint8_t mask = -(delta[d] & 1);
-      for(unsigned int k = 0; k < len_bytes; k++) {
-        d_trunc_mask[k] = d_trunc[k] & mask;
-      }
-
-      // Apply the d_trunc_mask to the vole_cache
-      uint8_t* q = vbb->vole_cache;
-      
-      // Shift offset and XOR into v
-      unsigned long row_bit_index   = (unsigned long)len * (col_idx);
-      unsigned long row_bit_offset  = row_bit_index % 8;
-      unsigned long row_byte_offset = row_bit_index / 8;
-      // Apply first byte
-      q[row_byte_offset] ^= d_trunc_mask[0] << row_bit_offset;
-      // Apply the remaining
-      for (unsigned int k = 1; k < len_bytes; k++) {
-        q[row_byte_offset + k] ^=
-            (d_trunc_mask[k - 1] >> (8 - row_bit_offset)) | (d_trunc_mask[k] << row_bit_offset);
-      }
+  extract_bits(d_trunc, d_ptr, start, effective_len);
 
-      if (row_bit_offset != 0) {
-        q[row_byte_offset + len_bytes] ^= d_trunc_mask[len_bytes - 1] >> (8 - row_bit_offset);
-      }
-      col_idx++;
+  for (unsigned int col_idx = 0; col_idx < lambda; col_idx++) {
+    // Apply d_trunc * delta to the blocks of 8 rows
+    const uint8_t mask = vbb->delta_masks[col_idx];
+    for (unsigned int k = 0; k < len_bytes; k++) {
+      q[k * lambda + col_idx] ^= d_trunc[k] & mask;
     }
   }
-  free(d_trunc);
-  free(d_trunc_mask);
+  faest_arena_free(scratch, d_trunc);
+  faest_arena_reset(scratch, mark);
 }
 
 static void apply_witness_values_column(vbb_t* vbb) {
-  const unsigned int tau           = vbb->params->faest_param.tau;
-  const unsigned int t0            = vbb->params->faest_param.t0;
-  const unsigned int k0            = vbb->params->faest_param.k0;
-  const unsigned int t1            = vbb->params->faest_param.t1;
-  const unsigned int k1            = vbb->params->faest_param.k1;
   const unsigned int lambda        = vbb->params->faest_param.lambda;
   const unsigned int l             = vbb->params->faest_param.l;
   const unsigned int ell_hat       = l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   const unsigned int ell_hat_bytes = ell_hat / 8;
+  const uint8_t* d                 = dsignature_d(vbb->sig, vbb->params);
 
   // Apply withness to CMO cache
-  unsigned int size = vbb->params->faest_param.l;
-  for (unsigned int i = 0, col = 0; i < tau; i++) {
-    unsigned int depth = i < t0 ? k0 : k1;
-    uint8_t decoded_challenge[MAX_DEPTH];
-    ChalDec(dsignature_chall_3(vbb->sig, vbb->params), i, k0, t0, k1, t1, decoded_challenge);
-    for (unsigned int j = 0; j < depth; j++, ++col) {
-      if (decoded_challenge[j] == 1) {
-        xor_u8_array(dsignature_d(vbb->sig, vbb->params), vbb->vole_cache + col * ell_hat_bytes,
-                     vbb->vole_cache + col * ell_hat_bytes, (size + 7) / 8);
-      }
-    }
+  for (unsigned int col = 0; col < lambda; ++col) {
+    masked_xor_u8_array(vbb->vole_cache + col * ell_hat_bytes, d,
+                        vbb->vole_cache + col * ell_hat_bytes, vbb->delta_bits[col], (l + 7) / 8);
   }
 }
 
-static void recompute_vole_row_reconstruct(vbb_t* vbb, unsigned int start, unsigned int len) {
-  const unsigned int lambda  = vbb->params->faest_param.lambda;
-  const unsigned int ell     = vbb->params->faest_param.l;
-  const unsigned int ell_hat = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
-
-  if (start >= ell) {
-    start = start - len + 1;
-  }
-  if (len >= ell + lambda) {
-    start = 0;
-  } else if (start + len > ell + lambda) {
-    start = ell + lambda - len;
-  }
+static void recompute_vole_row_reconstruct(const vbb_t* vbb, uint8_t* vole_cache,
+                                           unsigned int start, unsigned int len,
+                                           faest_vbb_stats_t* stats, faest_arena_t* scratch) {
+  const unsigned int lambda = vbb->params->faest_param.lambda;
 
   const uint8_t* chall3 = dsignature_chall_3(vbb->sig, vbb->params);
   const uint8_t* pdec[MAX_TAU];
   const uint8_t* com[MAX_TAU];
   setup_pdec_com(vbb, pdec, com);
-  partial_vole_reconstruct_row(vbb->iv, chall3, pdec, com, vbb->vole_cache, ell_hat, vbb->params,
-                               start, len);
-  apply_correction_values_row(vbb, start, len);
-  apply_witness_values_row(vbb, start, len);
-  
-  vbb->cache_idx = start;
+  partial_vole_reconstruct_row(vbb->iv, chall3, pdec, com, vole_cache, vbb->params, start, len,
+                               vbb->checkpoint.nodes ? &vbb->checkpoint : NULL, stats, scratch);
+  apply_correction_values_row(vbb, vole_cache, start, len, scratch);
+  apply_witness_values_row(vbb, vole_cache, start, len, scratch);
+  transpose_row_blocks(vole_cache, len, lambda);
+  ++stats->row_reconstructions;
 }
 
-void init_vbb_verify(vbb_t* vbb, unsigned int len, const faest_paramset_t* params,
+void init_vbb_verify(vbb_t* vbb, const vbb_config_t* config, const faest_paramset_t* params,
                      const uint8_t* sig) {
   const unsigned int lambda        = params->faest_param.lambda;
   const unsigned int lambda_bytes  = params->faest_param.lambda / 8;
   const unsigned int l             = params->faest_param.l;
   const unsigned int ell_hat       = l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   const unsigned int ell_hat_bytes = (ell_hat + 7) / 8;
-  const unsigned int row_count     = len;
+  const unsigned int row_count     = vbb_row_count_from_budget(config->max_vole_bytes, params);
   const unsigned int column_count =
       (size_t)row_count * (size_t)lambda_bytes / (size_t)ell_hat_bytes;
   assert(column_count >= 1);
 
-  vbb->party        = VERIFIER;
+  vbb->party = VERIFIER;
+  vbb->arena = config->arena;
+  faest_arena_reset(vbb->arena, 0);
   vbb->params       = params;
   vbb->iv           = dsignature_iv(sig, params);
-  vbb->com_hash     = calloc(MAX_LAMBDA_BYTES * 2, sizeof(uint8_t));
-  vbb->full_size    = len >= ell_hat;
+  vbb->com_hash     = alloc_com_hash(vbb->arena);
+  vbb->full_size    = row_count >= ell_hat;
   vbb->sig          = sig;
   vbb->row_count    = row_count;
-  vbb->vole_cache   = calloc(row_count, lambda_bytes);
+  vbb->vole_cache   = alloc_row_cache(vbb->arena, row_count, lambda_bytes);
+  vbb->vk_cache     = NULL;
+  vbb->vk_words     = NULL;
   vbb->column_count = column_count;
-  vbb->Dtilde_buf   = malloc(lambda_bytes + UNIVERSAL_HASH_B);
-  vbb->v_buf        = malloc(lambda_bytes);
+  vbb->Dtilde_buf   = faest_arena_alloc(vbb->arena, lambda_bytes + UNIVERSAL_HASH_B);
+  setup_delta(vbb);
+  setup_stats(vbb, config);
+  setup_row_segments(vbb, config);
+  trace_open(vbb);
 
-  // Setup vk_buf if we are not in an EM variant
-  if (!is_em_variant(vbb->params->faest_paramid)) {
-    vbb->vk_buf = malloc(lambda_bytes);
-  }
 
   const uint8_t* chall3 = dsignature_chall_3(vbb->sig, vbb->params);
   const uint8_t* pdec[MAX_TAU];
@@ -450,13 +843,18 @@ void init_vbb_verify(vbb_t* vbb, unsigned int len, const faest_paramset_t* param
                                          ? vole_mode_all_verify(vbb->vole_cache, vbb->com_hash)
                                          : vole_mode_hcom(vbb->com_hash);
   partial_vole_reconstruct_column(vbb->iv, chall3, pdec, com, ell_hat, 0, lambda, vole_mode,
-                                  vbb->params);
+                                  vbb->params, &vbb->stats, vbb->arena);
   if (vbb->full_size) {
     apply_correction_values_column(vbb, 0, lambda);
   }
+  if (setup_checkpoint(vbb, config)) {
+    vole_checkpoint_reconstruct(&vbb->checkpoint, vbb->iv, chall3, pdec, vbb->params);
+  }
 }
 
 void prepare_hash_verify(vbb_t* vbb) {
+  // the row windows share the cache with the columns
+  finish_prefetch(vbb);
   if (vbb->full_size) {
     vbb->cache_idx = 0;
     return;
@@ -465,39 +863,23 @@ void prepare_hash_verify(vbb_t* vbb) {
 }
 
 const uint8_t* get_dtilde(vbb_t* vbb, unsigned int idx) {
-  const unsigned int tau0         = vbb->params->faest_param.t0;
-  const unsigned int tau1         = vbb->params->faest_param.t1;
-  const unsigned int lambda       = vbb->params->faest_param.lambda;
-  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
   const unsigned int utilde_bytes = lambda_bytes + UNIVERSAL_HASH_B;
-  const unsigned int k0           = vbb->params->faest_param.k0;
-  const unsigned int k1           = vbb->params->faest_param.k1;
-
-  unsigned int t = 0;
-  unsigned int j = 0;
-  if (idx < k0 * tau0) {
-    t = idx / k0;
-    j = idx % k0;
-  } else {
-    t = tau0 + (idx - k0 * tau0) / k1;
-    j = (idx - k0 * tau0) % k1;
-  }
+  const uint8_t* u_tilde          = dsignature_u_tilde(vbb->sig, vbb->params);
+  const uint8_t mask              = vbb->delta_masks[idx];
 
-  uint8_t delta[MAX_DEPTH];
-  ChalDec(dsignature_chall_3(vbb->sig, vbb->params), t, k0, tau0, k1, tau1, delta);
-  memset(vbb->Dtilde_buf, 0, utilde_bytes);
-  masked_xor_u8_array(vbb->Dtilde_buf, dsignature_u_tilde(vbb->sig, vbb->params), vbb->Dtilde_buf,
-                      delta[j], utilde_bytes);
+  for (unsigned int i = 0; i < utilde_bytes; ++i) {
+    vbb->Dtilde_buf[i] = u_tilde[i] & mask;
+  }
   return vbb->Dtilde_buf;
 }
 
 void prepare_aes_verify(vbb_t* vbb) {
   if (vbb->full_size) {
     apply_witness_values_column(vbb);
-    vbb->cache_idx = 0;
-  } else {
-    recompute_vole_row_reconstruct(vbb, 0, vbb->row_count);
+    transpose_full_size(vbb);
   }
+  reset_row_segments(vbb);
   if (!is_em_variant(vbb->params->faest_paramid)) {
     setup_vk_cache(vbb);
   }
@@ -510,9 +892,13 @@ const uint8_t* get_vole_v_hash(vbb_t* vbb, unsigned int idx) {
   const unsigned int ell_hat       = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   const unsigned int ell_hat_bytes = (ell_hat + 7) / 8;
 
+  trace_access(vbb, 'h', idx);
   if (!is_column_cached(vbb, idx)) {
     unsigned int cmo_budget = vbb->column_count;
     recompute_hash_sign(vbb, idx, idx + cmo_budget);
+    ++vbb->stats.column_misses;
+  } else {
+    ++vbb->stats.column_hits;
   }
   
   const unsigned int offset = idx - vbb->cache_idx;
@@ -525,51 +911,92 @@ const uint8_t* get_vole_q_hash(vbb_t* vbb, unsigned int idx) {
   const unsigned int ell_hat       = ell + lambda * 2 + UNIVERSAL_HASH_B_BITS;
   const unsigned int ell_hat_bytes = (ell_hat + 7) / 8;
 
+  trace_access(vbb, 'h', idx);
   if (!is_column_cached(vbb, idx)) {
     unsigned int cmo_budget = vbb->column_count;
     recompute_hash_verify(vbb, idx, cmo_budget);
+    ++vbb->stats.column_misses;
+  } else {
+    ++vbb->stats.column_hits;
   }
 
   const unsigned int offset = idx - vbb->cache_idx;
   return vbb->vole_cache + offset * ell_hat_bytes;
 }
 
-static inline uint8_t* get_vole_row(vbb_t* vbb, unsigned int idx) {
-  unsigned int lambda       = vbb->params->faest_param.lambda;
-  unsigned int lambda_bytes = lambda / 8;
+static inline const uint8_t* get_vole_row(vbb_t* vbb, unsigned int idx) {
+  unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+
+  trace_access(vbb, 'r', idx);
+  const vbb_row_segment_t* segment = get_row_segment(vbb, idx);
+
+  // Compute the new idx based on the starting position of the segment
+  unsigned int idx_relative = idx - segment->start;
+  return segment->vole_cache + (size_t)idx_relative * lambda_bytes;
+}
+
+// Copy the rows [idx, idx + len) to out, which holds field elements of size stride, with one window
+// lookup per window touched. Rows beyond the witness are visited backwards and every row counts as
+// one access, so the window placement is the same as for single row accesses in that order.
+static void get_vole_rows(vbb_t* vbb, unsigned int idx, unsigned int len, uint8_t* out,
+                          size_t stride) {
+  const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+  const bool backwards            = idx >= vbb->params->faest_param.l;
+
+  while (len) {
+    const unsigned int row           = backwards ? idx + len - 1 : idx;
+    const vbb_row_segment_t* segment = get_row_segment(vbb, row);
+    const unsigned int first         = backwards ? MAX(idx, segment->start) : idx;
+    const unsigned int count =
+        backwards ? row + 1 - first : MIN(len, segment->start + vbb->segment_rows - idx);
+
+    for (unsigned int i = 0; i != count; ++i) {
+      trace_access(vbb, 'r', backwards ? row - i : row + i);
+    }
+    vbb->row_accesses += count - 1;
+    vbb->stats.row_hits += count - 1;
 
-  // Check if the idx is within the cache
-  if (!is_row_cached(vbb, idx)) {
-    unsigned int rmo_budget = vbb->row_count;
-    if (vbb->party == VERIFIER) {
-      recompute_vole_row_reconstruct(vbb, idx, rmo_budget);
+    uint8_t* dst = out + (first - idx) * stride;
+    if (stride == lambda_bytes) {
+      memcpy(dst, segment->vole_cache + (size_t)(first - segment->start) * lambda_bytes,
+             (size_t)count * lambda_bytes);
     } else {
-      recompute_vole_row(vbb, idx, rmo_budget);
+      const uint8_t* src = segment->vole_cache + (size_t)(first - segment->start) * lambda_bytes;
+      for (unsigned int i = 0; i != count; ++i, dst += stride, src += lambda_bytes) {
+        memcpy(dst, src, lambda_bytes);
+        memset(dst + lambda_bytes, 0, stride - lambda_bytes);
+      }
     }
-  }
 
-  // Always transpose the VOLE access
-  // Compute the new idx based on the starting position of the cache
-  unsigned int idx_relative = idx - vbb->cache_idx;
-  memset(vbb->v_buf, 0, lambda_bytes);
-  // Transpose the VOLE into the buffer
-  for (unsigned int column = 0; column != lambda; ++column) {
-    ptr_set_bit(vbb->v_buf, ptr_get_bit(vbb->vole_cache, idx_relative + vbb->row_count * column),
-                column);
+    len -= count;
+    if (!backwards) {
+      idx += count;
+    }
   }
-  return vbb->v_buf;
 }
 
 const bf256_t* get_vole_v_256(vbb_t* vbb, unsigned int idx) {
-  return (bf256_t*)get_vole_row(vbb, idx);
+  return (const bf256_t*)get_vole_row(vbb, idx);
 }
 
 const bf192_t* get_vole_v_192(vbb_t* vbb, unsigned int idx) {
-  return (bf192_t*)get_vole_row(vbb, idx);
+  return (const bf192_t*)get_vole_row(vbb, idx);
 }
 
 const bf128_t* get_vole_v_128(vbb_t* vbb, unsigned int idx) {
-  return (bf128_t*)get_vole_row(vbb, idx);
+  return (const bf128_t*)get_vole_row(vbb, idx);
+}
+
+void get_vole_v_256_range(vbb_t* vbb, unsigned int idx, unsigned int len, bf256_t* out) {
+  get_vole_rows(vbb, idx, len, (uint8_t*)out, sizeof(bf256_t));
+}
+
+void get_vole_v_192_range(vbb_t* vbb, unsigned int idx, unsigned int len, bf192_t* out) {
+  get_vole_rows(vbb, idx, len, (uint8_t*)out, sizeof(bf192_t));
+}
+
+void get_vole_v_128_range(vbb_t* vbb, unsigned int idx, unsigned int len, bf128_t* out) {
+  get_vole_rows(vbb, idx, len, (uint8_t*)out, sizeof(bf128_t));
 }
 
 const uint8_t* get_vole_u(vbb_t* vbb) {
@@ -581,135 +1008,136 @@ const uint8_t* get_com_hash(vbb_t* vbb) {
 }
 
 void clean_vbb(vbb_t* vbb) {
-  free(vbb->vole_cache);
-  free(vbb->com_hash);
-
-  free(vbb->v_buf);
+  trace_close(vbb);
+  finish_prefetch(vbb);
+  if (vbb->stats_out) {
+    *vbb->stats_out = vbb->stats;
+  }
+  free(vbb->prefetch);
+  faest_arena_free(vbb->arena, vbb->vole_cache);
+  faest_arena_free(vbb->arena, vbb->checkpoint.nodes);
+  faest_arena_free(vbb->arena, vbb->com_hash);
 
   if (vbb->party == VERIFIER) {
-    free(vbb->Dtilde_buf);
+    faest_arena_free(vbb->arena, vbb->Dtilde_buf);
+    faest_arena_free(vbb->arena, vbb->delta_bits);
+    faest_arena_free(vbb->arena, vbb->delta_masks);
   } else {
-    free(vbb->vole_U);
+    faest_arena_free(vbb->arena, vbb->vole_U);
   }
 
   // V_k cache
   if (!is_em_variant(vbb->params->faest_paramid)) {
-    free(vbb->vk_buf);
-    free(vbb->vk_cache);
+    faest_arena_free(vbb->arena, vbb->vk_cache);
+    faest_arena_free(vbb->arena, vbb->vk_words);
   }
+  faest_arena_reset(vbb->arena, 0);
 }
 
 // V_k cache
 
-static void setup_vk_cache(vbb_t* vbb) {
-  unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
-  unsigned int l_ke         = vbb->params->faest_param.Lke;
-
-  vbb->vk_cache = calloc(l_ke, lambda_bytes);
-
-  for (unsigned int i = 0; i < l_ke; i++) {
-    unsigned int offset = i * lambda_bytes;
-    memcpy(vbb->vk_cache + offset, get_vole_row(vbb, i), lambda_bytes);
-  }
+// Key schedule words whose tags are stored in the VOLE correlations. The tags of the other words
+// are the sum of the tags of the words w - Nwd and w - 1.
+static inline unsigned int vk_stored_step(unsigned int nwd) {
+  return nwd > 6 ? 4 : nwd;
 }
 
-static inline uint8_t* get_vk(vbb_t* vbb, unsigned int idx) {
-  unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
-  assert(idx < vbb->params->faest_param.Lke);
+static inline bool vk_word_stored(unsigned int w, unsigned int nwd) {
+  return w < nwd || w % vk_stored_step(nwd) == 0;
+}
 
-  unsigned int offset = idx * lambda_bytes;
-  return (vbb->vk_cache + offset);
+// Tags of the stored word w in vk_cache
+static inline const uint8_t* vk_stored_word(const vbb_t* vbb, unsigned int w) {
+  const unsigned int lambda = vbb->params->faest_param.lambda;
+  const unsigned int nwd    = vbb->params->faest_param.Nwd;
+  const unsigned int row    = w < nwd ? w * 32 : lambda + (w - nwd) / vk_stored_step(nwd) * 32;
+  return vbb->vk_cache + (size_t)row * (lambda / 8);
 }
 
-const bf128_t* get_vk_128(vbb_t* vbb, unsigned int idx) {
-  if (idx < FAEST_128F_LAMBDA) {
-    const bf128_t* vk = (bf128_t*)get_vk(vbb, idx);
-    memcpy(vbb->vk_buf, vk, sizeof(bf128_t));
-    return (bf128_t*)vbb->vk_buf;
+// In full size mode, the tags of all 4 * (R + 1) words are computed once. Otherwise, only the
+// stored words are kept and the others are computed on demand in a window of the last Nwd words.
+static void setup_vk_cache(vbb_t* vbb) {
+  const unsigned int lambda       = vbb->params->faest_param.lambda;
+  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int l_ke         = vbb->params->faest_param.Lke;
+  const unsigned int nwd          = vbb->params->faest_param.Nwd;
+  const unsigned int words        = 4 * (vbb->params->faest_param.R + 1);
+  const size_t word_bytes         = 32 * (size_t)lambda_bytes;
+
+  if (!vbb->full_size) {
+    vbb->vk_cache = alloc_row_cache(vbb->arena, l_ke, lambda_bytes);
+    for (unsigned int i = 0; i < l_ke; i++) {
+      memcpy(vbb->vk_cache + (size_t)i * lambda_bytes, get_vole_row(vbb, i), lambda_bytes);
+    }
+    vbb->vk_words      = alloc_row_cache(vbb->arena, nwd * 32, lambda_bytes);
+    vbb->vk_window_end = 0;
+    return;
   }
 
-  unsigned int j = idx / 32 + FAEST_128F_Nwd;
-  if ((j % FAEST_128F_Nwd) == 0 || (FAEST_128F_Nwd > 6 && (j % FAEST_128F_Nwd) == 4)) {
-    unsigned int i_wd       = FAEST_128F_LAMBDA;
-    unsigned int factor_128 = (idx / 128) - 1;
-    unsigned int offset_128 = idx % 128;
-    unsigned int index      = i_wd + factor_128 * 32 + offset_128;
-    const bf128_t* vk       = (bf128_t*)get_vk(vbb, index);
-    memcpy(vbb->vk_buf, vk, sizeof(bf128_t));
-    return (bf128_t*)vbb->vk_buf;
+  vbb->vk_cache = NULL;
+  vbb->vk_words = alloc_row_cache(vbb->arena, words * 32, lambda_bytes);
+  for (unsigned int i = 0; i < l_ke; i++) {
+    const unsigned int w =
+        i < lambda ? i / 32 : nwd + (i - lambda) / 32 * vk_stored_step(nwd);
+    memcpy(vbb->vk_words + w * word_bytes + (i % 32) * lambda_bytes, get_vole_row(vbb, i),
+           lambda_bytes);
   }
-
-  // Lhs recursive call
-  const bf128_t* lhs_ptr = get_vk_128(vbb, idx - FAEST_128F_Nwd * 32);
-  bf128_t lhs            = *lhs_ptr;
-  // Rhs recursive call
-  const bf128_t* rhs_ptr = get_vk_128(vbb, idx - 32);
-  bf128_t rhs            = *rhs_ptr;
-
-  bf128_t vk = bf128_add(lhs, rhs);
-  memcpy(vbb->vk_buf, &vk, sizeof(bf128_t));
-  return (bf128_t*)vbb->vk_buf;
+  for (unsigned int w = nwd; w < words; w++) {
+    if (!vk_word_stored(w, nwd)) {
+      xor_u8_array(vbb->vk_words + (w - nwd) * word_bytes, vbb->vk_words + (w - 1) * word_bytes,
+                   vbb->vk_words + w * word_bytes, word_bytes);
+    }
+  }
+  vbb->vk_window_end = words;
 }
 
-const bf192_t* get_vk_192(vbb_t* vbb, unsigned int idx) {
-  if (idx < FAEST_192F_LAMBDA) {
-    const bf192_t* vk = (bf192_t*)get_vk(vbb, idx);
-    memcpy(vbb->vk_buf, vk, sizeof(bf192_t));
-    return (bf192_t*)vbb->vk_buf;
+// Return the tags of key schedule word w. The window is advanced to w; accesses before the window
+// restart it from the first words.
+static const uint8_t* get_vk_word(vbb_t* vbb, unsigned int w) {
+  const unsigned int nwd  = vbb->params->faest_param.Nwd;
+  const size_t word_bytes = 32 * (size_t)(vbb->params->faest_param.lambda / 8);
+  assert(w < 4u * (vbb->params->faest_param.R + 1u));
+
+  if (vbb->full_size) {
+    return vbb->vk_words + w * word_bytes;
+  }
+  if (vk_word_stored(w, nwd)) {
+    return vk_stored_word(vbb, w);
   }
 
-  unsigned int j = idx / 32 + FAEST_192F_Nwd;
-  if ((j % FAEST_192F_Nwd) == 0 || (FAEST_192F_Nwd > 6 && (j % FAEST_192F_Nwd) == 4)) {
-    unsigned int i_wd       = FAEST_192F_LAMBDA;
-    unsigned int factor_192 = (idx / 192) - 1;
-    unsigned int offset_192 = idx % 192;
-    unsigned int index      = i_wd + factor_192 * 32 + offset_192;
-    const bf192_t* vk       = (bf192_t*)get_vk(vbb, index);
-    memcpy(vbb->vk_buf, vk, sizeof(bf192_t));
-    return (bf192_t*)vbb->vk_buf;
+  if (w + nwd < vbb->vk_window_end || vbb->vk_window_end < nwd) {
+    for (unsigned int i = 0; i < nwd; i++) {
+      memcpy(vbb->vk_words + i * word_bytes, vk_stored_word(vbb, i), word_bytes);
+    }
+    vbb->vk_window_end = nwd;
   }
+  for (; vbb->vk_window_end <= w; ++vbb->vk_window_end) {
+    const unsigned int next = vbb->vk_window_end;
+    // the slot of word next - Nwd is replaced by word next
+    uint8_t* slot = vbb->vk_words + (next % nwd) * word_bytes;
+    if (vk_word_stored(next, nwd)) {
+      memcpy(slot, vk_stored_word(vbb, next), word_bytes);
+    } else {
+      xor_u8_array(slot, vbb->vk_words + ((next - 1) % nwd) * word_bytes, slot, word_bytes);
+    }
+  }
+  return vbb->vk_words + (w % nwd) * word_bytes;
+}
 
-  // Lhs recursive call
-  const bf192_t* lhs_ptr = get_vk_192(vbb, idx - FAEST_192F_Nwd * 32);
-  bf192_t lhs            = *lhs_ptr;
-  // Rhs recursive call
-  const bf192_t* rhs_ptr = get_vk_192(vbb, idx - 32);
-  bf192_t rhs            = *rhs_ptr;
+static inline const uint8_t* get_vk(vbb_t* vbb, unsigned int idx) {
+  const unsigned int lambda_bytes = vbb->params->faest_param.lambda / 8;
+  trace_access(vbb, 'k', idx);
+  return get_vk_word(vbb, idx / 32) + (idx % 32) * lambda_bytes;
+}
 
-  bf192_t vk = bf192_add(lhs, rhs);
-  memcpy(vbb->vk_buf, &vk, 3 * sizeof(uint64_t));
-  return (bf192_t*)vbb->vk_buf;
+const bf128_t* get_vk_128(vbb_t* vbb, unsigned int idx) {
+  return (const bf128_t*)get_vk(vbb, idx);
+}
+
+const bf192_t* get_vk_192(vbb_t* vbb, unsigned int idx) {
+  return (const bf192_t*)get_vk(vbb, idx);
 }
 
 const bf256_t* get_vk_256(vbb_t* vbb, unsigned int idx) {
-  if (idx < FAEST_256F_LAMBDA) {
-    const bf256_t* vk = (bf256_t*)get_vk(vbb, idx);
-    memcpy(vbb->vk_buf, vk, sizeof(bf256_t));
-    return (bf256_t*)vbb->vk_buf;
-  }
-
-  // We go from j=N_k to j=4(R+1)
-  // In our case this is j=8 to j=4(14+1)=60
-  // Based on each j we have 32 tags in vk
-  unsigned int j = idx / 32 + FAEST_256F_Nwd;
-  if ((j % FAEST_256F_Nwd) == 0 || (FAEST_256F_Nwd > 6 && (j % FAEST_256F_Nwd) == 4)) {
-    unsigned int i_wd       = FAEST_256F_LAMBDA;
-    unsigned int factor_128 = (idx / 128) - 2;
-    unsigned int offset_128 = idx % 128;
-    unsigned int index      = i_wd + factor_128 * 32 + offset_128;
-    const bf256_t* vk       = (bf256_t*)get_vk(vbb, index);
-    memcpy(vbb->vk_buf, vk, sizeof(bf256_t));
-    return (bf256_t*)vbb->vk_buf;
-  }
-
-  // Lhs recursive call
-  const bf256_t* lhs_ptr = get_vk_256(vbb, idx - FAEST_256F_Nwd * 32);
-  bf256_t lhs            = *lhs_ptr;
-  // Rhs recursive call
-  const bf256_t* rhs_ptr = get_vk_256(vbb, idx - 32);
-  bf256_t rhs            = *rhs_ptr;
-
-  bf256_t vk = bf256_add(lhs, rhs);
-  memcpy(vbb->vk_buf, &vk, sizeof(bf256_t));
-  return (bf256_t*)vbb->vk_buf;
+  return (const bf256_t*)get_vk(vbb, idx);
 }
@@ -1,8 +1,12 @@
 #ifndef VBB_H
 #define VBB_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#if defined(FAEST_VBB_TRACE)
+#include <stdio.h>
+#endif
 
 #include "vole.h"
 
@@ -10,54 +14,152 @@ typedef struct vbb_t vbb_t;
 #include "fields.h"
 #include "faest_aes.h"
 
+FAEST_BEGIN_C_DECL
+
+#define VBB_MAX_ROW_SEGMENTS 8
+#define VBB_DEFAULT_ROW_SEGMENTS 1
+
+typedef struct vbb_config_t {
+  size_t max_vole_bytes;         // Memory budget of the VOLE cache
+  unsigned int row_segments;     // Number of independently cached row windows
+  bool prefetch;                 // Compute the next row window in a background thread
+  unsigned int checkpoint_level; // GGM tree level kept for row recomputations, 0 to disable
+  faest_vbb_stats_t* stats;      // Receives the statistics in clean_vbb, NULL to disable
+  faest_arena_t* arena;          // Holds the buffers of one vbb_t at a time, NULL to use the heap
+} vbb_config_t;
+
+typedef struct vbb_prefetch_t vbb_prefetch_t;
+
+typedef struct vbb_row_segment_t {
+  unsigned int start;  // First row held by the segment
+  uint64_t last_use;   // Time of the last access, 0 if the segment holds no rows
+  uint8_t* vole_cache; // segment_rows rows stored row-major
+} vbb_row_segment_t;
+
 typedef enum party_t {
   VERIFIER,
   SIGNER,
 } party_t;
 
+// Precomputed window placement for one row miss, see tools/vbb_planner.py
+typedef struct vbb_schedule_entry_t {
+  uint16_t access; // Number of the row access since prepare_aes_* that misses
+  uint16_t start;  // First row of the window to compute
+  uint8_t segment; // Segment replaced by the window
+} vbb_schedule_entry_t;
+
+typedef struct vbb_schedule_t {
+  faest_paramid_t paramid;
+  party_t party;
+  unsigned int segment_count;
+  unsigned int segment_rows;
+  unsigned int len;
+  const vbb_schedule_entry_t* entries;
+} vbb_schedule_t;
+
+// Fastest configuration for a total memory budget of the VOLE cache and the checkpoint, see
+// tools/vbb_tune.c
+typedef struct vbb_tuning_t {
+  faest_paramid_t paramid;
+  size_t total_bytes;
+  unsigned int row_segments;
+  unsigned int checkpoint_level;
+} vbb_tuning_t;
+
 struct vbb_t {
   // Signer
   uint8_t* vole_U;
   // Verifier
   const uint8_t* sig;
   uint8_t* Dtilde_buf;
+  // Bits of chall_3 for each VOLE column, and the same bits as 0x00/0xFF masks
+  uint8_t* delta_bits;
+  uint8_t* delta_masks;
   // Common
   party_t party;
   unsigned int row_count;    // Budget of RMO computation
   unsigned int column_count; // Budget of CMO computation
   unsigned int cache_idx;
+  // RMO cache, split into independently recomputed segments
+  unsigned int segment_count;
+  unsigned int segment_rows;
+  vbb_row_segment_t segments[VBB_MAX_ROW_SEGMENTS];
+  uint64_t row_clock;
+  vbb_prefetch_t* prefetch;
+  // Window placement for the row misses, NULL if none is available or the accesses deviated
+  const vbb_schedule_t* schedule;
+  unsigned int schedule_pos;
+  unsigned int row_accesses;
+  // Tree nodes to recompute rows from, nodes is NULL if disabled
+  vole_checkpoint_t checkpoint;
   const uint8_t* root_key;
   const faest_paramset_t* params;
   const uint8_t* iv;
+  // Buffers and scratch space of the calling thread, NULL to use the heap
+  faest_arena_t* arena;
   uint8_t* vole_cache;
   uint8_t* com_hash;
+  // Statistics, recompute_ns is only measured if stats_out is not NULL
+  faest_vbb_stats_t stats;
+  faest_vbb_stats_t* stats_out;
   // Optimizing parameters
   bool full_size;
-  uint8_t* v_buf;
-  // Vk_cache
-  uint8_t* vk_buf;
+  // Vk_cache: the stored key schedule tags, and all words in full size mode or a window of the
+  // last Nwd words otherwise
   uint8_t* vk_cache;
+  uint8_t* vk_words;
+  unsigned int vk_window_end; // One past the last word in vk_words
+#if defined(FAEST_VBB_TRACE)
+  // Access trace for tools/vbb_planner.py
+  FILE* trace;
+#endif
 };
 
-void init_vbb_sign(vbb_t* vbb, unsigned int len, const uint8_t* root_key, const uint8_t* iv,
-                   uint8_t* c, const faest_paramset_t* params);
+// Converts a memory budget (in bytes) for the VOLE cache into the number of cached rows. Returns 0
+// if the budget cannot hold a single VOLE column.
+unsigned int vbb_row_count_from_budget(size_t max_vole_bytes, const faest_paramset_t* params);
+
+// Size of an arena that holds all buffers of a vbb_t with the given configuration. The arena is
+// reset by init_vbb_sign, init_vbb_verify and clean_vbb.
+size_t vbb_arena_bytes(party_t party, const vbb_config_t* config, const faest_paramset_t* params);
+
+// Memory needed by the checkpoint of the given level, 0 for level 0.
+size_t vbb_checkpoint_bytes(unsigned int level, const faest_paramset_t* params);
+// Configuration for a total memory budget, including the checkpoint. Budgets below the full budget
+// use the tuned configuration of the largest budget in vbb_tuning.h that fits, if any.
+vbb_config_t vbb_config_from_budget(size_t total_bytes, const faest_paramset_t* params);
+
+// The budget of config needs to be accepted by vbb_row_count_from_budget.
+void init_vbb_sign(vbb_t* vbb, const vbb_config_t* config, const uint8_t* root_key,
+                   const uint8_t* iv, uint8_t* c, const faest_paramset_t* params);
 void clean_vbb(vbb_t* vbb);
 void prepare_hash_sign(vbb_t* vbb);
+// Pass the columns of V in order to fn. Bounded caches that hold the columns of one tree stream
+// them from the commitment without recomputing any tree.
+void hash_columns_sign(vbb_t* vbb, vole_column_fn fn, void* ctx);
+// In full size mode, this converts the VOLE to rows, so get_vole_v_hash may no longer be called.
 void prepare_aes_sign(vbb_t* vbb);
 const uint8_t* get_vole_v_hash(vbb_t* vbb, unsigned int idx);
+// The returned rows stay valid as long as the window holding them is cached, i.e., other rows can
+// be requested as long as they do not miss. In full size mode, all rows stay valid.
 const bf256_t* get_vole_v_256(vbb_t* vbb, unsigned int idx);
 const bf192_t* get_vole_v_192(vbb_t* vbb, unsigned int idx);
 const bf128_t* get_vole_v_128(vbb_t* vbb, unsigned int idx);
+// Copy the len consecutive rows starting at idx to out.
+void get_vole_v_256_range(vbb_t* vbb, unsigned int idx, unsigned int len, bf256_t* out);
+void get_vole_v_192_range(vbb_t* vbb, unsigned int idx, unsigned int len, bf192_t* out);
+void get_vole_v_128_range(vbb_t* vbb, unsigned int idx, unsigned int len, bf128_t* out);
 const uint8_t* get_vole_u(vbb_t* vbb);
 const uint8_t* get_com_hash(vbb_t* vbb);
 void vector_open_ondemand(vbb_t* vbb, unsigned int idx, const uint8_t* s_, uint8_t* sig_pdec,
                           uint8_t* sig_com, unsigned int depth);
 
 // Verifier
-void init_vbb_verify(vbb_t* vbb, unsigned int len, const faest_paramset_t* params,
+void init_vbb_verify(vbb_t* vbb, const vbb_config_t* config, const faest_paramset_t* params,
                      const uint8_t* sig);
 void prepare_hash_verify(vbb_t* vbb);
 const uint8_t* get_vole_q_hash(vbb_t* vbb, unsigned int idx);
+// In full size mode, this converts the VOLE to rows, so get_vole_q_hash may no longer be called.
 void prepare_aes_verify(vbb_t* vbb);
 const uint8_t* get_dtilde(vbb_t* vbb, unsigned int idx);
 
@@ -66,4 +168,6 @@ const bf128_t* get_vk_128(vbb_t* vbb, unsigned int idx);
 const bf192_t* get_vk_192(vbb_t* vbb, unsigned int idx);
 const bf256_t* get_vk_256(vbb_t* vbb, unsigned int idx);
 
+FAEST_END_C_DECL
+
 #endif
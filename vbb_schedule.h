@@ -0,0 +1,1170 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+// Generated by tools/vbb_planner.py. Do not edit.
+
+#ifndef VBB_SCHEDULE_H
+#define VBB_SCHEDULE_H
+
+#include "vbb.h"
+
+static const vbb_schedule_entry_t vbb_schedule_0[] = {
+    {0, 0, 0},
+    {232, 232, 1},
+    {784, 464, 0},
+    {1016, 696, 0},
+    {1248, 928, 0},
+    {1480, 1160, 0},
+    {1712, 1368, 0},
+    {1936, 464, 1},
+    {2168, 696, 1},
+    {2400, 928, 1},
+    {2632, 1160, 1},
+    {3072, 1496, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_1[] = {
+    {0, 0, 0},
+    {112, 112, 1},
+    {224, 224, 0},
+    {336, 336, 0},
+    {544, 224, 1},
+    {768, 448, 0},
+    {880, 560, 1},
+    {992, 672, 1},
+    {1104, 784, 1},
+    {1216, 896, 1},
+    {1328, 1008, 1},
+    {1440, 1120, 1},
+    {1552, 1232, 1},
+    {1664, 1344, 1},
+    {1776, 1456, 1},
+    {1888, 1488, 1},
+    {2032, 560, 0},
+    {2144, 672, 0},
+    {2256, 784, 0},
+    {2368, 896, 0},
+    {2480, 1008, 0},
+    {2592, 1120, 0},
+    {2704, 1232, 0},
+    {2816, 1344, 0},
+    {2928, 1456, 0},
+    {3072, 1616, 0},
+    {3184, 1600, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_2[] = {
+    {0, 0, 0},
+    {56, 56, 1},
+    {112, 112, 0},
+    {168, 168, 1},
+    {224, 224, 1},
+    {280, 280, 1},
+    {336, 336, 1},
+    {392, 392, 1},
+    {488, 168, 0},
+    {544, 224, 0},
+    {600, 280, 0},
+    {656, 336, 0},
+    {768, 448, 0},
+    {824, 504, 1},
+    {880, 560, 1},
+    {936, 616, 1},
+    {992, 672, 1},
+    {1048, 728, 1},
+    {1104, 784, 1},
+    {1160, 840, 1},
+    {1216, 896, 1},
+    {1272, 952, 1},
+    {1328, 1008, 1},
+    {1384, 1064, 1},
+    {1440, 1120, 1},
+    {1496, 1176, 1},
+    {1552, 1232, 1},
+    {1608, 1288, 1},
+    {1664, 1344, 1},
+    {1720, 1400, 1},
+    {1776, 1456, 1},
+    {1832, 1512, 1},
+    {1888, 1544, 1},
+    {1976, 504, 0},
+    {2032, 560, 0},
+    {2088, 616, 0},
+    {2144, 672, 0},
+    {2200, 728, 0},
+    {2256, 784, 0},
+    {2312, 840, 0},
+    {2368, 896, 0},
+    {2424, 952, 0},
+    {2480, 1008, 0},
+    {2536, 1064, 0},
+    {2592, 1120, 0},
+    {2648, 1176, 0},
+    {2704, 1232, 0},
+    {2760, 1288, 0},
+    {2816, 1344, 0},
+    {2872, 1400, 0},
+    {2928, 1456, 0},
+    {2984, 1512, 0},
+    {3072, 1672, 0},
+    {3128, 1616, 0},
+    {3184, 1600, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_3[] = {
+    {0, 0, 0},
+    {2088, 448, 0},
+    {3944, 1624, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_4[] = {
+    {0, 0, 0},
+    {1168, 912, 1},
+    {2080, 944, 1},
+    {2576, 912, 0},
+    {3520, 1856, 0},
+    {4432, 2544, 1},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_5[] = {
+    {0, 0, 0},
+    {712, 456, 1},
+    {1168, 912, 1},
+    {1624, 1368, 1},
+    {2080, 1400, 1},
+    {2120, 456, 0},
+    {2576, 912, 0},
+    {3032, 1368, 0},
+    {3520, 1856, 0},
+    {3976, 2312, 1},
+    {4432, 2768, 1},
+    {4888, 2808, 1},
+    {5384, 2312, 0},
+    {5840, 2768, 0},
+    {6336, 3000, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_6[] = {
+    {0, 0, 0},
+    {224, 224, 1},
+    {704, 448, 0},
+    {928, 672, 1},
+    {1152, 896, 1},
+    {1376, 1120, 1},
+    {1600, 1344, 1},
+    {1824, 1568, 1},
+    {2048, 1632, 1},
+    {2336, 672, 0},
+    {2560, 896, 0},
+    {2784, 1120, 0},
+    {3008, 1344, 0},
+    {3232, 1568, 0},
+    {3520, 1856, 0},
+    {3744, 2080, 1},
+    {3968, 2304, 1},
+    {4192, 2528, 1},
+    {4416, 2752, 1},
+    {4640, 2976, 1},
+    {4864, 3040, 1},
+    {5152, 2080, 0},
+    {5376, 2304, 0},
+    {5600, 2528, 0},
+    {5824, 2752, 0},
+    {6048, 2976, 0},
+    {6336, 3232, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_7[] = {
+    {0, 0, 0},
+    {112, 112, 1},
+    {224, 224, 0},
+    {336, 336, 0},
+    {480, 224, 1},
+    {704, 448, 0},
+    {816, 560, 1},
+    {928, 672, 1},
+    {1040, 784, 1},
+    {1152, 896, 1},
+    {1264, 1008, 1},
+    {1376, 1120, 1},
+    {1488, 1232, 1},
+    {1600, 1344, 1},
+    {1712, 1456, 1},
+    {1824, 1568, 1},
+    {1936, 1680, 1},
+    {2048, 1744, 1},
+    {2224, 560, 0},
+    {2336, 672, 0},
+    {2448, 784, 0},
+    {2560, 896, 0},
+    {2672, 1008, 0},
+    {2784, 1120, 0},
+    {2896, 1232, 0},
+    {3008, 1344, 0},
+    {3120, 1456, 0},
+    {3232, 1568, 0},
+    {3344, 1680, 0},
+    {3520, 1856, 0},
+    {3632, 1968, 1},
+    {3744, 2080, 1},
+    {3856, 2192, 1},
+    {3968, 2304, 1},
+    {4080, 2416, 1},
+    {4192, 2528, 1},
+    {4304, 2640, 1},
+    {4416, 2752, 1},
+    {4528, 2864, 1},
+    {4640, 2976, 1},
+    {4752, 3088, 1},
+    {4864, 3152, 1},
+    {5040, 1968, 0},
+    {5152, 2080, 0},
+    {5264, 2192, 0},
+    {5376, 2304, 0},
+    {5488, 2416, 0},
+    {5600, 2528, 0},
+    {5712, 2640, 0},
+    {5824, 2752, 0},
+    {5936, 2864, 0},
+    {6048, 2976, 0},
+    {6160, 3088, 0},
+    {6336, 3344, 0},
+    {6448, 3264, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_8[] = {
+    {0, 0, 0},
+    {2680, 672, 0},
+    {5016, 1992, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_9[] = {
+    {0, 0, 0},
+    {1544, 1128, 1},
+    {2672, 1208, 1},
+    {3208, 1128, 0},
+    {4416, 2336, 0},
+    {5544, 3128, 1},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_10[] = {
+    {0, 0, 0},
+    {560, 560, 1},
+    {1536, 1120, 0},
+    {2096, 1680, 0},
+    {2656, 1776, 0},
+    {3200, 1120, 1},
+    {3760, 1680, 1},
+    {4416, 2336, 0},
+    {4976, 2896, 1},
+    {5536, 3440, 1},
+    {6640, 2896, 0},
+    {7744, 3696, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_11[] = {
+    {0, 0, 0},
+    {560, 256, 0},
+    {1232, 816, 0},
+    {1792, 1376, 0},
+    {2352, 1776, 0},
+    {2752, 672, 0},
+    {3312, 1232, 0},
+    {3872, 1792, 0},
+    {4432, 2352, 0},
+    {4992, 2912, 0},
+    {5552, 3440, 0},
+    {6080, 2336, 0},
+    {6640, 2896, 0},
+    {7200, 3456, 0},
+    {7744, 3696, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_12[] = {
+    {0, 0, 0},
+    {280, 280, 1},
+    {560, 392, 1},
+    {696, 280, 0},
+    {1088, 672, 0},
+    {1368, 952, 1},
+    {1648, 1232, 1},
+    {1928, 1512, 1},
+    {2208, 1792, 1},
+    {2488, 2056, 1},
+    {3032, 952, 0},
+    {3312, 1232, 0},
+    {3592, 1512, 0},
+    {3872, 1792, 0},
+    {4416, 2336, 0},
+    {4696, 2616, 1},
+    {4976, 2896, 1},
+    {5256, 3176, 1},
+    {5536, 3456, 1},
+    {5816, 3720, 1},
+    {6360, 2616, 0},
+    {6640, 2896, 0},
+    {6920, 3176, 0},
+    {7200, 3456, 0},
+    {7744, 3976, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_13[] = {
+    {0, 0, 0},
+    {136, 136, 1},
+    {272, 272, 0},
+    {408, 408, 0},
+    {544, 536, 0},
+    {688, 272, 1},
+    {824, 408, 1},
+    {1088, 672, 0},
+    {1224, 808, 1},
+    {1360, 944, 1},
+    {1496, 1080, 1},
+    {1632, 1216, 1},
+    {1768, 1352, 1},
+    {1904, 1488, 1},
+    {2040, 1624, 1},
+    {2176, 1760, 1},
+    {2312, 1896, 1},
+    {2448, 2032, 1},
+    {2584, 2168, 1},
+    {2720, 2200, 1},
+    {2888, 808, 0},
+    {3024, 944, 0},
+    {3160, 1080, 0},
+    {3296, 1216, 0},
+    {3432, 1352, 0},
+    {3568, 1488, 0},
+    {3704, 1624, 0},
+    {3840, 1760, 0},
+    {3976, 1896, 0},
+    {4112, 2032, 0},
+    {4248, 2168, 0},
+    {4416, 2336, 0},
+    {4552, 2472, 1},
+    {4688, 2608, 1},
+    {4824, 2744, 1},
+    {4960, 2880, 1},
+    {5096, 3016, 1},
+    {5232, 3152, 1},
+    {5368, 3288, 1},
+    {5504, 3424, 1},
+    {5640, 3560, 1},
+    {5776, 3696, 1},
+    {5912, 3832, 1},
+    {6048, 3864, 1},
+    {6216, 2472, 0},
+    {6352, 2608, 0},
+    {6488, 2744, 0},
+    {6624, 2880, 0},
+    {6760, 3016, 0},
+    {6896, 3152, 0},
+    {7032, 3288, 0},
+    {7168, 3424, 0},
+    {7304, 3560, 0},
+    {7440, 3696, 0},
+    {7576, 3832, 0},
+    {7744, 4120, 0},
+    {7880, 4000, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_14[] = {
+    {0, 0, 0},
+    {384, 384, 1},
+    {768, 768, 1},
+    {1152, 896, 1},
+    {1664, 384, 0},
+    {2048, 768, 0},
+    {2560, 1024, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_15[] = {
+    {0, 0, 0},
+    {192, 192, 1},
+    {384, 384, 1},
+    {576, 576, 1},
+    {768, 768, 1},
+    {960, 960, 1},
+    {1152, 1088, 1},
+    {1472, 192, 0},
+    {1664, 384, 0},
+    {1856, 576, 0},
+    {2048, 768, 0},
+    {2240, 960, 0},
+    {2560, 1216, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_16[] = {
+    {0, 0, 0},
+    {96, 96, 1},
+    {192, 192, 1},
+    {288, 288, 1},
+    {384, 384, 1},
+    {480, 480, 1},
+    {576, 576, 1},
+    {672, 672, 1},
+    {768, 768, 1},
+    {864, 864, 1},
+    {960, 960, 1},
+    {1056, 1056, 1},
+    {1152, 1152, 1},
+    {1248, 1184, 1},
+    {1376, 96, 0},
+    {1472, 192, 0},
+    {1568, 288, 0},
+    {1664, 384, 0},
+    {1760, 480, 0},
+    {1856, 576, 0},
+    {1952, 672, 0},
+    {2048, 768, 0},
+    {2144, 864, 0},
+    {2240, 960, 0},
+    {2336, 1056, 0},
+    {2432, 1152, 0},
+    {2560, 1312, 0},
+    {2656, 1280, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_17[] = {
+    {0, 0, 0},
+    {48, 48, 1},
+    {96, 96, 1},
+    {144, 144, 1},
+    {192, 192, 1},
+    {240, 240, 1},
+    {288, 288, 1},
+    {336, 336, 1},
+    {384, 384, 1},
+    {432, 432, 1},
+    {480, 480, 1},
+    {528, 528, 1},
+    {576, 576, 1},
+    {624, 624, 1},
+    {672, 672, 1},
+    {720, 720, 1},
+    {768, 768, 1},
+    {816, 816, 1},
+    {864, 864, 1},
+    {912, 912, 1},
+    {960, 960, 1},
+    {1008, 1008, 1},
+    {1056, 1056, 1},
+    {1104, 1104, 1},
+    {1152, 1152, 1},
+    {1200, 1200, 1},
+    {1248, 1232, 1},
+    {1328, 48, 0},
+    {1376, 96, 0},
+    {1424, 144, 0},
+    {1472, 192, 0},
+    {1520, 240, 0},
+    {1568, 288, 0},
+    {1616, 336, 0},
+    {1664, 384, 0},
+    {1712, 432, 0},
+    {1760, 480, 0},
+    {1808, 528, 0},
+    {1856, 576, 0},
+    {1904, 624, 0},
+    {1952, 672, 0},
+    {2000, 720, 0},
+    {2048, 768, 0},
+    {2096, 816, 0},
+    {2144, 864, 0},
+    {2192, 912, 0},
+    {2240, 960, 0},
+    {2288, 1008, 0},
+    {2336, 1056, 0},
+    {2384, 1104, 0},
+    {2432, 1152, 0},
+    {2480, 1200, 0},
+    {2560, 1360, 0},
+    {2608, 1312, 0},
+    {2656, 1280, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_18[] = {
+    {0, 0, 0},
+    {512, 384, 1},
+    {896, 768, 1},
+    {1280, 896, 1},
+    {1664, 384, 0},
+    {2048, 768, 0},
+    {2560, 1024, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_19[] = {
+    {0, 0, 0},
+    {320, 192, 1},
+    {512, 384, 1},
+    {704, 576, 1},
+    {896, 768, 1},
+    {1088, 960, 1},
+    {1280, 1088, 1},
+    {1472, 192, 0},
+    {1664, 384, 0},
+    {1856, 576, 0},
+    {2048, 768, 0},
+    {2240, 960, 0},
+    {2560, 1216, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_20[] = {
+    {0, 0, 0},
+    {96, 96, 1},
+    {320, 192, 0},
+    {416, 288, 0},
+    {512, 384, 0},
+    {608, 480, 0},
+    {704, 576, 0},
+    {800, 672, 0},
+    {896, 768, 0},
+    {992, 864, 0},
+    {1088, 960, 0},
+    {1184, 1056, 0},
+    {1280, 1152, 0},
+    {1376, 1184, 0},
+    {1472, 192, 1},
+    {1568, 288, 1},
+    {1664, 384, 1},
+    {1760, 480, 1},
+    {1856, 576, 1},
+    {1952, 672, 1},
+    {2048, 768, 1},
+    {2144, 864, 1},
+    {2240, 960, 1},
+    {2336, 1056, 1},
+    {2432, 1152, 1},
+    {2560, 1312, 0},
+    {2656, 1280, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_21[] = {
+    {0, 0, 0},
+    {48, 48, 1},
+    {96, 80, 1},
+    {176, 48, 0},
+    {256, 128, 0},
+    {304, 176, 1},
+    {352, 224, 1},
+    {400, 272, 1},
+    {448, 320, 1},
+    {496, 368, 1},
+    {544, 416, 1},
+    {592, 464, 1},
+    {640, 512, 1},
+    {688, 560, 1},
+    {736, 608, 1},
+    {784, 656, 1},
+    {832, 704, 1},
+    {880, 752, 1},
+    {928, 800, 1},
+    {976, 848, 1},
+    {1024, 896, 1},
+    {1072, 944, 1},
+    {1120, 992, 1},
+    {1168, 1040, 1},
+    {1216, 1088, 1},
+    {1264, 1136, 1},
+    {1312, 1184, 1},
+    {1360, 1232, 1},
+    {1456, 176, 0},
+    {1504, 224, 0},
+    {1552, 272, 0},
+    {1600, 320, 0},
+    {1648, 368, 0},
+    {1696, 416, 0},
+    {1744, 464, 0},
+    {1792, 512, 0},
+    {1840, 560, 0},
+    {1888, 608, 0},
+    {1936, 656, 0},
+    {1984, 704, 0},
+    {2032, 752, 0},
+    {2080, 800, 0},
+    {2128, 848, 0},
+    {2176, 896, 0},
+    {2224, 944, 0},
+    {2272, 992, 0},
+    {2320, 1040, 0},
+    {2368, 1088, 0},
+    {2416, 1136, 0},
+    {2464, 1184, 0},
+    {2560, 1360, 0},
+    {2608, 1312, 0},
+    {2656, 1280, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_22[] = {
+    {0, 0, 0},
+    {672, 672, 1},
+    {1344, 1344, 1},
+    {2016, 1632, 1},
+    {2976, 672, 0},
+    {3648, 1344, 0},
+    {4608, 1824, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_23[] = {
+    {0, 0, 0},
+    {336, 336, 1},
+    {672, 672, 1},
+    {1008, 1008, 1},
+    {1344, 1344, 1},
+    {1680, 1680, 1},
+    {2016, 1968, 1},
+    {2640, 336, 0},
+    {2976, 672, 0},
+    {3312, 1008, 0},
+    {3648, 1344, 0},
+    {3984, 1680, 0},
+    {4608, 2160, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_24[] = {
+    {0, 0, 0},
+    {168, 168, 1},
+    {336, 336, 1},
+    {504, 504, 1},
+    {672, 672, 1},
+    {840, 840, 1},
+    {1008, 1008, 1},
+    {1176, 1176, 1},
+    {1344, 1344, 1},
+    {1512, 1512, 1},
+    {1680, 1680, 1},
+    {1848, 1848, 1},
+    {2016, 2016, 1},
+    {2184, 2136, 1},
+    {2472, 168, 0},
+    {2640, 336, 0},
+    {2808, 504, 0},
+    {2976, 672, 0},
+    {3144, 840, 0},
+    {3312, 1008, 0},
+    {3480, 1176, 0},
+    {3648, 1344, 0},
+    {3816, 1512, 0},
+    {3984, 1680, 0},
+    {4152, 1848, 0},
+    {4320, 2016, 0},
+    {4608, 2328, 0},
+    {4776, 2304, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_25[] = {
+    {0, 0, 0},
+    {80, 80, 1},
+    {160, 160, 1},
+    {240, 240, 1},
+    {320, 320, 1},
+    {400, 400, 1},
+    {480, 480, 1},
+    {560, 560, 1},
+    {640, 640, 1},
+    {720, 720, 1},
+    {800, 800, 1},
+    {880, 880, 1},
+    {960, 960, 1},
+    {1040, 1040, 1},
+    {1120, 1120, 1},
+    {1200, 1200, 1},
+    {1280, 1280, 1},
+    {1360, 1360, 1},
+    {1440, 1440, 1},
+    {1520, 1520, 1},
+    {1600, 1600, 1},
+    {1680, 1680, 1},
+    {1760, 1760, 1},
+    {1840, 1840, 1},
+    {1920, 1920, 1},
+    {2000, 2000, 1},
+    {2080, 2080, 1},
+    {2160, 2160, 1},
+    {2240, 2224, 1},
+    {2384, 80, 0},
+    {2464, 160, 0},
+    {2544, 240, 0},
+    {2624, 320, 0},
+    {2704, 400, 0},
+    {2784, 480, 0},
+    {2864, 560, 0},
+    {2944, 640, 0},
+    {3024, 720, 0},
+    {3104, 800, 0},
+    {3184, 880, 0},
+    {3264, 960, 0},
+    {3344, 1040, 0},
+    {3424, 1120, 0},
+    {3504, 1200, 0},
+    {3584, 1280, 0},
+    {3664, 1360, 0},
+    {3744, 1440, 0},
+    {3824, 1520, 0},
+    {3904, 1600, 0},
+    {3984, 1680, 0},
+    {4064, 1760, 0},
+    {4144, 1840, 0},
+    {4224, 1920, 0},
+    {4304, 2000, 0},
+    {4384, 2080, 0},
+    {4464, 2160, 0},
+    {4608, 2416, 0},
+    {4688, 2336, 0},
+    {4768, 2304, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_26[] = {
+    {0, 0, 0},
+    {864, 672, 1},
+    {1536, 1344, 1},
+    {2208, 1632, 1},
+    {2976, 672, 0},
+    {3648, 1344, 0},
+    {4608, 1824, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_27[] = {
+    {0, 0, 0},
+    {528, 336, 1},
+    {864, 672, 1},
+    {1200, 1008, 1},
+    {1536, 1344, 1},
+    {1872, 1680, 1},
+    {2208, 1968, 1},
+    {2640, 336, 0},
+    {2976, 672, 0},
+    {3312, 1008, 0},
+    {3648, 1344, 0},
+    {3984, 1680, 0},
+    {4608, 2160, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_28[] = {
+    {0, 0, 0},
+    {168, 168, 1},
+    {528, 336, 0},
+    {696, 504, 0},
+    {864, 672, 0},
+    {1032, 840, 0},
+    {1200, 1008, 0},
+    {1368, 1176, 0},
+    {1536, 1344, 0},
+    {1704, 1512, 0},
+    {1872, 1680, 0},
+    {2040, 1848, 0},
+    {2208, 2016, 0},
+    {2376, 2136, 0},
+    {2640, 336, 1},
+    {2808, 504, 1},
+    {2976, 672, 1},
+    {3144, 840, 1},
+    {3312, 1008, 1},
+    {3480, 1176, 1},
+    {3648, 1344, 1},
+    {3816, 1512, 1},
+    {3984, 1680, 1},
+    {4152, 1848, 1},
+    {4320, 2016, 1},
+    {4608, 2328, 0},
+    {4776, 2304, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_29[] = {
+    {0, 0, 0},
+    {80, 80, 1},
+    {160, 112, 1},
+    {272, 80, 0},
+    {384, 192, 0},
+    {464, 272, 1},
+    {544, 352, 1},
+    {624, 432, 1},
+    {704, 512, 1},
+    {784, 592, 1},
+    {864, 672, 1},
+    {944, 752, 1},
+    {1024, 832, 1},
+    {1104, 912, 1},
+    {1184, 992, 1},
+    {1264, 1072, 1},
+    {1344, 1152, 1},
+    {1424, 1232, 1},
+    {1504, 1312, 1},
+    {1584, 1392, 1},
+    {1664, 1472, 1},
+    {1744, 1552, 1},
+    {1824, 1632, 1},
+    {1904, 1712, 1},
+    {1984, 1792, 1},
+    {2064, 1872, 1},
+    {2144, 1952, 1},
+    {2224, 2032, 1},
+    {2304, 2112, 1},
+    {2384, 2192, 1},
+    {2464, 2224, 1},
+    {2576, 272, 0},
+    {2656, 352, 0},
+    {2736, 432, 0},
+    {2816, 512, 0},
+    {2896, 592, 0},
+    {2976, 672, 0},
+    {3056, 752, 0},
+    {3136, 832, 0},
+    {3216, 912, 0},
+    {3296, 992, 0},
+    {3376, 1072, 0},
+    {3456, 1152, 0},
+    {3536, 1232, 0},
+    {3616, 1312, 0},
+    {3696, 1392, 0},
+    {3776, 1472, 0},
+    {3856, 1552, 0},
+    {3936, 1632, 0},
+    {4016, 1712, 0},
+    {4096, 1792, 0},
+    {4176, 1872, 0},
+    {4256, 1952, 0},
+    {4336, 2032, 0},
+    {4416, 2112, 0},
+    {4496, 2192, 0},
+    {4608, 2416, 0},
+    {4688, 2336, 0},
+    {4768, 2304, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_30[] = {
+    {0, 0, 0},
+    {1024, 1024, 1},
+    {2048, 2048, 1},
+    {3072, 2560, 1},
+    {4608, 1024, 0},
+    {5632, 2048, 0},
+    {7168, 2816, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_31[] = {
+    {0, 0, 0},
+    {512, 512, 1},
+    {1024, 1024, 1},
+    {1536, 1536, 1},
+    {2048, 2048, 1},
+    {2560, 2560, 1},
+    {3072, 3072, 1},
+    {4096, 512, 0},
+    {4608, 1024, 0},
+    {5120, 1536, 0},
+    {5632, 2048, 0},
+    {6144, 2560, 0},
+    {7168, 3328, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_32[] = {
+    {0, 0, 0},
+    {256, 256, 1},
+    {512, 512, 1},
+    {768, 768, 1},
+    {1024, 1024, 1},
+    {1280, 1280, 1},
+    {1536, 1536, 1},
+    {1792, 1792, 1},
+    {2048, 2048, 1},
+    {2304, 2304, 1},
+    {2560, 2560, 1},
+    {2816, 2816, 1},
+    {3072, 3072, 1},
+    {3328, 3328, 1},
+    {3840, 256, 0},
+    {4096, 512, 0},
+    {4352, 768, 0},
+    {4608, 1024, 0},
+    {4864, 1280, 0},
+    {5120, 1536, 0},
+    {5376, 1792, 0},
+    {5632, 2048, 0},
+    {5888, 2304, 0},
+    {6144, 2560, 0},
+    {6400, 2816, 0},
+    {6656, 3072, 0},
+    {7168, 3584, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_33[] = {
+    {0, 0, 0},
+    {128, 128, 1},
+    {256, 256, 1},
+    {384, 384, 1},
+    {512, 512, 1},
+    {640, 640, 1},
+    {768, 768, 1},
+    {896, 896, 1},
+    {1024, 1024, 1},
+    {1152, 1152, 1},
+    {1280, 1280, 1},
+    {1408, 1408, 1},
+    {1536, 1536, 1},
+    {1664, 1664, 1},
+    {1792, 1792, 1},
+    {1920, 1920, 1},
+    {2048, 2048, 1},
+    {2176, 2176, 1},
+    {2304, 2304, 1},
+    {2432, 2432, 1},
+    {2560, 2560, 1},
+    {2688, 2688, 1},
+    {2816, 2816, 1},
+    {2944, 2944, 1},
+    {3072, 3072, 1},
+    {3200, 3200, 1},
+    {3328, 3328, 1},
+    {3456, 3456, 1},
+    {3712, 128, 0},
+    {3840, 256, 0},
+    {3968, 384, 0},
+    {4096, 512, 0},
+    {4224, 640, 0},
+    {4352, 768, 0},
+    {4480, 896, 0},
+    {4608, 1024, 0},
+    {4736, 1152, 0},
+    {4864, 1280, 0},
+    {4992, 1408, 0},
+    {5120, 1536, 0},
+    {5248, 1664, 0},
+    {5376, 1792, 0},
+    {5504, 1920, 0},
+    {5632, 2048, 0},
+    {5760, 2176, 0},
+    {5888, 2304, 0},
+    {6016, 2432, 0},
+    {6144, 2560, 0},
+    {6272, 2688, 0},
+    {6400, 2816, 0},
+    {6528, 2944, 0},
+    {6656, 3072, 0},
+    {6784, 3200, 0},
+    {6912, 3328, 0},
+    {7168, 3712, 0},
+    {7296, 3584, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_34[] = {
+    {0, 0, 0},
+    {1280, 1024, 1},
+    {2304, 2048, 1},
+    {3328, 2560, 1},
+    {4608, 1024, 0},
+    {5632, 2048, 0},
+    {7168, 2816, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_35[] = {
+    {0, 0, 0},
+    {768, 512, 1},
+    {1280, 1024, 1},
+    {1792, 1536, 1},
+    {2304, 2048, 1},
+    {2816, 2560, 1},
+    {3328, 3072, 1},
+    {4096, 512, 0},
+    {4608, 1024, 0},
+    {5120, 1536, 0},
+    {5632, 2048, 0},
+    {6144, 2560, 0},
+    {7168, 3328, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_36[] = {
+    {0, 0, 0},
+    {512, 256, 1},
+    {768, 512, 0},
+    {1024, 768, 0},
+    {1280, 1024, 0},
+    {1536, 1280, 0},
+    {1792, 1536, 0},
+    {2048, 1792, 0},
+    {2304, 2048, 0},
+    {2560, 2304, 0},
+    {2816, 2560, 0},
+    {3072, 2816, 0},
+    {3328, 3072, 0},
+    {3584, 3328, 0},
+    {4096, 512, 1},
+    {4352, 768, 1},
+    {4608, 1024, 1},
+    {4864, 1280, 1},
+    {5120, 1536, 1},
+    {5376, 1792, 1},
+    {5632, 2048, 1},
+    {5888, 2304, 1},
+    {6144, 2560, 1},
+    {6400, 2816, 1},
+    {6656, 3072, 1},
+    {7168, 3584, 0},
+};
+
+static const vbb_schedule_entry_t vbb_schedule_37[] = {
+    {0, 0, 0},
+    {128, 128, 1},
+    {512, 256, 0},
+    {640, 384, 1},
+    {768, 512, 1},
+    {896, 640, 1},
+    {1024, 768, 1},
+    {1152, 896, 1},
+    {1280, 1024, 1},
+    {1408, 1152, 1},
+    {1536, 1280, 1},
+    {1664, 1408, 1},
+    {1792, 1536, 1},
+    {1920, 1664, 1},
+    {2048, 1792, 1},
+    {2176, 1920, 1},
+    {2304, 2048, 1},
+    {2432, 2176, 1},
+    {2560, 2304, 1},
+    {2688, 2432, 1},
+    {2816, 2560, 1},
+    {2944, 2688, 1},
+    {3072, 2816, 1},
+    {3200, 2944, 1},
+    {3328, 3072, 1},
+    {3456, 3200, 1},
+    {3584, 3328, 1},
+    {3712, 3456, 1},
+    {3968, 384, 0},
+    {4096, 512, 0},
+    {4224, 640, 0},
+    {4352, 768, 0},
+    {4480, 896, 0},
+    {4608, 1024, 0},
+    {4736, 1152, 0},
+    {4864, 1280, 0},
+    {4992, 1408, 0},
+    {5120, 1536, 0},
+    {5248, 1664, 0},
+    {5376, 1792, 0},
+    {5504, 1920, 0},
+    {5632, 2048, 0},
+    {5760, 2176, 0},
+    {5888, 2304, 0},
+    {6016, 2432, 0},
+    {6144, 2560, 0},
+    {6272, 2688, 0},
+    {6400, 2816, 0},
+    {6528, 2944, 0},
+    {6656, 3072, 0},
+    {6784, 3200, 0},
+    {6912, 3328, 0},
+    {7168, 3712, 0},
+    {7296, 3584, 0},
+};
+
+static const vbb_schedule_t vbb_schedules[] = {
+    {FAEST_128F, SIGNER, 2, 232, 12, vbb_schedule_0},
+    {FAEST_128F, SIGNER, 2, 112, 27, vbb_schedule_1},
+    {FAEST_128F, SIGNER, 2, 56, 55, vbb_schedule_2},
+    {FAEST_128F, VERIFIER, 2, 232, 12, vbb_schedule_0},
+    {FAEST_128F, VERIFIER, 2, 112, 27, vbb_schedule_1},
+    {FAEST_128F, VERIFIER, 2, 56, 55, vbb_schedule_2},
+    {FAEST_128S, SIGNER, 2, 232, 12, vbb_schedule_0},
+    {FAEST_128S, SIGNER, 2, 112, 27, vbb_schedule_1},
+    {FAEST_128S, SIGNER, 2, 56, 55, vbb_schedule_2},
+    {FAEST_128S, VERIFIER, 2, 232, 12, vbb_schedule_0},
+    {FAEST_128S, VERIFIER, 2, 112, 27, vbb_schedule_1},
+    {FAEST_128S, VERIFIER, 2, 56, 55, vbb_schedule_2},
+    {FAEST_192F, SIGNER, 1, 1832, 3, vbb_schedule_3},
+    {FAEST_192F, SIGNER, 2, 912, 6, vbb_schedule_4},
+    {FAEST_192F, SIGNER, 2, 456, 15, vbb_schedule_5},
+    {FAEST_192F, SIGNER, 2, 224, 27, vbb_schedule_6},
+    {FAEST_192F, SIGNER, 2, 112, 55, vbb_schedule_7},
+    {FAEST_192F, VERIFIER, 1, 1832, 3, vbb_schedule_3},
+    {FAEST_192F, VERIFIER, 2, 912, 6, vbb_schedule_4},
+    {FAEST_192F, VERIFIER, 2, 456, 15, vbb_schedule_5},
+    {FAEST_192F, VERIFIER, 2, 224, 27, vbb_schedule_6},
+    {FAEST_192F, VERIFIER, 2, 112, 55, vbb_schedule_7},
+    {FAEST_192S, SIGNER, 1, 1832, 3, vbb_schedule_3},
+    {FAEST_192S, SIGNER, 2, 912, 6, vbb_schedule_4},
+    {FAEST_192S, SIGNER, 2, 456, 15, vbb_schedule_5},
+    {FAEST_192S, SIGNER, 2, 224, 27, vbb_schedule_6},
+    {FAEST_192S, SIGNER, 2, 112, 55, vbb_schedule_7},
+    {FAEST_192S, VERIFIER, 1, 1832, 3, vbb_schedule_3},
+    {FAEST_192S, VERIFIER, 2, 912, 6, vbb_schedule_4},
+    {FAEST_192S, VERIFIER, 2, 456, 15, vbb_schedule_5},
+    {FAEST_192S, VERIFIER, 2, 224, 27, vbb_schedule_6},
+    {FAEST_192S, VERIFIER, 2, 112, 55, vbb_schedule_7},
+    {FAEST_256F, SIGNER, 1, 2264, 3, vbb_schedule_8},
+    {FAEST_256F, SIGNER, 2, 1128, 6, vbb_schedule_9},
+    {FAEST_256F, SIGNER, 2, 560, 12, vbb_schedule_10},
+    {FAEST_256F, SIGNER, 1, 560, 15, vbb_schedule_11},
+    {FAEST_256F, SIGNER, 2, 280, 25, vbb_schedule_12},
+    {FAEST_256F, SIGNER, 2, 136, 57, vbb_schedule_13},
+    {FAEST_256F, VERIFIER, 1, 2264, 3, vbb_schedule_8},
+    {FAEST_256F, VERIFIER, 2, 1128, 6, vbb_schedule_9},
+    {FAEST_256F, VERIFIER, 2, 560, 12, vbb_schedule_10},
+    {FAEST_256F, VERIFIER, 1, 560, 15, vbb_schedule_11},
+    {FAEST_256F, VERIFIER, 2, 280, 25, vbb_schedule_12},
+    {FAEST_256F, VERIFIER, 2, 136, 57, vbb_schedule_13},
+    {FAEST_256S, SIGNER, 1, 2264, 3, vbb_schedule_8},
+    {FAEST_256S, SIGNER, 2, 1128, 6, vbb_schedule_9},
+    {FAEST_256S, SIGNER, 2, 560, 12, vbb_schedule_10},
+    {FAEST_256S, SIGNER, 1, 560, 15, vbb_schedule_11},
+    {FAEST_256S, SIGNER, 2, 280, 25, vbb_schedule_12},
+    {FAEST_256S, SIGNER, 2, 136, 57, vbb_schedule_13},
+    {FAEST_256S, VERIFIER, 1, 2264, 3, vbb_schedule_8},
+    {FAEST_256S, VERIFIER, 2, 1128, 6, vbb_schedule_9},
+    {FAEST_256S, VERIFIER, 2, 560, 12, vbb_schedule_10},
+    {FAEST_256S, VERIFIER, 1, 560, 15, vbb_schedule_11},
+    {FAEST_256S, VERIFIER, 2, 280, 25, vbb_schedule_12},
+    {FAEST_256S, VERIFIER, 2, 136, 57, vbb_schedule_13},
+    {FAEST_EM_128F, SIGNER, 2, 384, 7, vbb_schedule_14},
+    {FAEST_EM_128F, SIGNER, 2, 192, 13, vbb_schedule_15},
+    {FAEST_EM_128F, SIGNER, 2, 96, 28, vbb_schedule_16},
+    {FAEST_EM_128F, SIGNER, 2, 48, 55, vbb_schedule_17},
+    {FAEST_EM_128F, VERIFIER, 2, 384, 7, vbb_schedule_18},
+    {FAEST_EM_128F, VERIFIER, 2, 192, 13, vbb_schedule_19},
+    {FAEST_EM_128F, VERIFIER, 2, 96, 27, vbb_schedule_20},
+    {FAEST_EM_128F, VERIFIER, 2, 48, 53, vbb_schedule_21},
+    {FAEST_EM_128S, SIGNER, 2, 384, 7, vbb_schedule_14},
+    {FAEST_EM_128S, SIGNER, 2, 192, 13, vbb_schedule_15},
+    {FAEST_EM_128S, SIGNER, 2, 96, 28, vbb_schedule_16},
+    {FAEST_EM_128S, SIGNER, 2, 48, 55, vbb_schedule_17},
+    {FAEST_EM_128S, VERIFIER, 2, 384, 7, vbb_schedule_18},
+    {FAEST_EM_128S, VERIFIER, 2, 192, 13, vbb_schedule_19},
+    {FAEST_EM_128S, VERIFIER, 2, 96, 27, vbb_schedule_20},
+    {FAEST_EM_128S, VERIFIER, 2, 48, 53, vbb_schedule_21},
+    {FAEST_EM_192F, SIGNER, 2, 672, 7, vbb_schedule_22},
+    {FAEST_EM_192F, SIGNER, 2, 336, 13, vbb_schedule_23},
+    {FAEST_EM_192F, SIGNER, 2, 168, 28, vbb_schedule_24},
+    {FAEST_EM_192F, SIGNER, 2, 80, 59, vbb_schedule_25},
+    {FAEST_EM_192F, VERIFIER, 2, 672, 7, vbb_schedule_26},
+    {FAEST_EM_192F, VERIFIER, 2, 336, 13, vbb_schedule_27},
+    {FAEST_EM_192F, VERIFIER, 2, 168, 27, vbb_schedule_28},
+    {FAEST_EM_192F, VERIFIER, 2, 80, 59, vbb_schedule_29},
+    {FAEST_EM_192S, SIGNER, 2, 672, 7, vbb_schedule_22},
+    {FAEST_EM_192S, SIGNER, 2, 336, 13, vbb_schedule_23},
+    {FAEST_EM_192S, SIGNER, 2, 168, 28, vbb_schedule_24},
+    {FAEST_EM_192S, SIGNER, 2, 80, 59, vbb_schedule_25},
+    {FAEST_EM_192S, VERIFIER, 2, 672, 7, vbb_schedule_26},
+    {FAEST_EM_192S, VERIFIER, 2, 336, 13, vbb_schedule_27},
+    {FAEST_EM_192S, VERIFIER, 2, 168, 27, vbb_schedule_28},
+    {FAEST_EM_192S, VERIFIER, 2, 80, 59, vbb_schedule_29},
+    {FAEST_EM_256F, SIGNER, 2, 1024, 7, vbb_schedule_30},
+    {FAEST_EM_256F, SIGNER, 2, 512, 13, vbb_schedule_31},
+    {FAEST_EM_256F, SIGNER, 2, 256, 27, vbb_schedule_32},
+    {FAEST_EM_256F, SIGNER, 2, 128, 56, vbb_schedule_33},
+    {FAEST_EM_256F, VERIFIER, 2, 1024, 7, vbb_schedule_34},
+    {FAEST_EM_256F, VERIFIER, 2, 512, 13, vbb_schedule_35},
+    {FAEST_EM_256F, VERIFIER, 2, 256, 26, vbb_schedule_36},
+    {FAEST_EM_256F, VERIFIER, 2, 128, 54, vbb_schedule_37},
+    {FAEST_EM_256S, SIGNER, 2, 1024, 7, vbb_schedule_30},
+    {FAEST_EM_256S, SIGNER, 2, 512, 13, vbb_schedule_31},
+    {FAEST_EM_256S, SIGNER, 2, 256, 27, vbb_schedule_32},
+    {FAEST_EM_256S, SIGNER, 2, 128, 56, vbb_schedule_33},
+    {FAEST_EM_256S, VERIFIER, 2, 1024, 7, vbb_schedule_34},
+    {FAEST_EM_256S, VERIFIER, 2, 512, 13, vbb_schedule_35},
+    {FAEST_EM_256S, VERIFIER, 2, 256, 26, vbb_schedule_36},
+    {FAEST_EM_256S, VERIFIER, 2, 128, 54, vbb_schedule_37},
+};
+
+#endif
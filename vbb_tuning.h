@@ -0,0 +1,63 @@
+/*
+ *  SPDX-License-Identifier: MIT
+ */
+
+// Generated by tools/vbb_tune.c. Do not edit.
+
+#ifndef VBB_TUNING_H
+#define VBB_TUNING_H
+
+#include "vbb.h"
+
+static const vbb_tuning_t vbb_tunings[] = {
+    {FAEST_128S, 14976, 1, 4},
+    {FAEST_128S, 7488, 1, 0},
+    {FAEST_128S, 3744, 1, 2},
+    {FAEST_128S, 1872, 1, 2},
+    {FAEST_128F, 14976, 1, 4},
+    {FAEST_128F, 7488, 1, 2},
+    {FAEST_128F, 3744, 1, 2},
+    {FAEST_128F, 1872, 1, 0},
+    {FAEST_192S, 43968, 1, 2},
+    {FAEST_192S, 21984, 1, 2},
+    {FAEST_192S, 10992, 1, 2},
+    {FAEST_192S, 5496, 1, 2},
+    {FAEST_192F, 43968, 1, 0},
+    {FAEST_192F, 21984, 1, 2},
+    {FAEST_192F, 10992, 1, 2},
+    {FAEST_192F, 5496, 1, 0},
+    {FAEST_256S, 72448, 1, 2},
+    {FAEST_256S, 36224, 1, 4},
+    {FAEST_256S, 18112, 1, 2},
+    {FAEST_256S, 9056, 1, 2},
+    {FAEST_256F, 72448, 1, 0},
+    {FAEST_256F, 36224, 1, 2},
+    {FAEST_256F, 18112, 1, 2},
+    {FAEST_256F, 9056, 1, 0},
+    {FAEST_EM_128S, 12416, 1, 4},
+    {FAEST_EM_128S, 6208, 1, 2},
+    {FAEST_EM_128S, 3104, 1, 2},
+    {FAEST_EM_128S, 1552, 1, 0},
+    {FAEST_EM_128F, 12416, 1, 2},
+    {FAEST_EM_128F, 6208, 1, 2},
+    {FAEST_EM_128F, 3104, 1, 2},
+    {FAEST_EM_128F, 1552, 1, 0},
+    {FAEST_EM_192S, 32448, 1, 2},
+    {FAEST_EM_192S, 16224, 1, 2},
+    {FAEST_EM_192S, 8112, 1, 2},
+    {FAEST_EM_192S, 4056, 1, 2},
+    {FAEST_EM_192F, 32448, 1, 2},
+    {FAEST_EM_192F, 16224, 1, 2},
+    {FAEST_EM_192F, 8112, 1, 2},
+    {FAEST_EM_192F, 4056, 1, 0},
+    {FAEST_EM_256S, 65792, 1, 4},
+    {FAEST_EM_256S, 32896, 1, 4},
+    {FAEST_EM_256S, 16448, 1, 2},
+    {FAEST_EM_256S, 8224, 1, 0},
+    {FAEST_EM_256F, 65792, 1, 2},
+    {FAEST_EM_256F, 32896, 1, 2},
+    {FAEST_EM_256F, 16448, 1, 2},
+    {FAEST_EM_256F, 8224, 1, 0},
+};
+
+#endif
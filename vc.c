@@ -31,6 +31,26 @@ static void H0(const uint8_t* node, uint32_t lambda, const uint8_t* iv, uint8_t*
   H0_final(&h0_ctx, sd, lambda_bytes, com, (lambda_bytes * 2));
 }
 
+void leaf_sd_com(const uint8_t* leaf, const uint8_t* iv, uint32_t lambda, uint8_t* sd,
+                 uint8_t* com) {
+  H0(leaf, lambda, iv, sd, com);
+}
+
+void expand_nodes(const uint8_t* node, const uint8_t* iv, uint32_t lambda, unsigned int levels,
+                  uint8_t* nodes) {
+  const unsigned int lambda_bytes = lambda / 8;
+  uint8_t children[2 * MAX_LAMBDA_BYTES];
+
+  memcpy(nodes, node, lambda_bytes);
+  for (unsigned int level = 0; level < levels; level++) {
+    // Expand backwards so that each node is read before its slot is overwritten
+    for (size_t j = (size_t)1 << level; j-- > 0;) {
+      prg(nodes + j * lambda_bytes, iv, children, lambda, lambda_bytes * 2);
+      memcpy(nodes + 2 * j * lambda_bytes, children, lambda_bytes * 2);
+    }
+  }
+}
+
 void vector_commitment(const uint8_t* rootKey, uint32_t lambda, uint32_t depth, uint8_t* path_nodes,
                        vec_com_t* vec_com) {
   const unsigned int lambda_bytes = lambda / 8;
@@ -36,6 +36,13 @@ void extract_sd_com(vec_com_t* vec_com, const uint8_t* iv, uint32_t lambda, unsi
 void extract_sd_com_rec(vec_com_rec_t* vec_com_rec, const uint8_t* iv, uint32_t lambda,
                     unsigned int index, uint8_t* sd, uint8_t* com);
 
+// Derive seed and commitment of a leaf of the GGM tree
+void leaf_sd_com(const uint8_t* leaf, const uint8_t* iv, uint32_t lambda, uint8_t* sd,
+                 uint8_t* com);
+// Expand node by levels levels, writing its 2^levels descendants from left to right to nodes
+void expand_nodes(const uint8_t* node, const uint8_t* iv, uint32_t lambda, unsigned int levels,
+                  uint8_t* nodes);
+
 void vector_commitment(const uint8_t* rootKey, uint32_t lambda, uint32_t depth, uint8_t* path_nodes,
                        vec_com_t* vec_com);
 void vector_open(vec_com_t* vec_com_rec, const uint8_t* b, uint8_t* cop, uint8_t* com_j,
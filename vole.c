@@ -10,10 +10,20 @@
 #include "aes.h"
 #include "utils.h"
 #include "random_oracle.h"
+#include "endian_compat.h"
+#include "arena.h"
 
 #include <stdbool.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_AVX2_TARGET
+#endif
+
 int ChalDec(const uint8_t* chal, unsigned int i, unsigned int k0, unsigned int t0, unsigned int k1,
             unsigned int t1, uint8_t* chalout) {
   if (i >= t0 + t1) {
@@ -41,7 +51,8 @@ int ChalDec(const uint8_t* chal, unsigned int i, unsigned int k0, unsigned int t
 
 void partial_vole_commit_column(const uint8_t* rootKey, const uint8_t* iv, unsigned int ellhat,
                                 unsigned int start, unsigned int end,
-                                sign_vole_mode_ctx_t vole_mode, const faest_paramset_t* params) {
+                                sign_vole_mode_ctx_t vole_mode, const faest_paramset_t* params,
+                                faest_vbb_stats_t* stats, faest_arena_t* scratch) {
   unsigned int lambda       = params->faest_param.lambda;
   unsigned int lambda_bytes = lambda / 8;
   unsigned int ellhat_bytes = (ellhat + 7) / 8;
@@ -50,17 +61,18 @@ void partial_vole_commit_column(const uint8_t* rootKey, const uint8_t* iv, unsig
   unsigned int k0           = params->faest_param.k0;
   unsigned int k1           = params->faest_param.k1;
   unsigned int max_depth    = MAX(k0, k1);
+  const size_t mark         = faest_arena_mark(scratch);
 
-  uint8_t* expanded_keys = malloc(tau * lambda_bytes);
+  uint8_t* expanded_keys = faest_arena_alloc(scratch, tau * lambda_bytes);
   prg(rootKey, iv, expanded_keys, lambda, lambda_bytes * tau);
-  uint8_t* path = malloc(lambda_bytes * max_depth * 2);
-  uint8_t* r    = malloc(ellhat_bytes);
+  uint8_t* path = faest_arena_alloc(scratch, lambda_bytes * max_depth * 2);
+  uint8_t* r    = faest_arena_alloc(scratch, ellhat_bytes);
 
   H1_context_t hcom_ctx;
   H1_context_t com_ctx;
   uint8_t* h = NULL;
   if (vole_mode.mode != EXCLUDE_U_HCOM_C) {
-    h = malloc(lambda_bytes * 2);
+    h = faest_arena_alloc(scratch, lambda_bytes * 2);
     H1_init(&hcom_ctx, lambda);
   }
 
@@ -83,9 +95,11 @@ void partial_vole_commit_column(const uint8_t* rootKey, const uint8_t* iv, unsig
     bool is_first_tree      = (t == 0);
     unsigned int tree_depth = t < tau0 ? k0 : k1;
 
-    // v_cache_offset is used to compute the index we should write v to relative to our cache
-    unsigned int v_cache_offset =
-        (v_progress > start) ? v_progress - start : 0; // (i.e. MAX(v_progress-start, 0))
+    // v_cache_offset is used to compute the index we should write v to relative to our cache.
+    // When streaming, the cache only holds the columns of the current tree.
+    unsigned int v_cache_offset = (v_progress > start && !vole_mode.column_fn)
+                                      ? v_progress - start
+                                      : 0; // (i.e. MAX(v_progress-start, 0))
     // [v_start, v_end] is the v's that t provides (capped by requested start/end)
     unsigned int v_start = MAX(v_progress, start);
     unsigned int v_end   = MIN(end, v_progress + tree_depth);
@@ -146,118 +160,322 @@ void partial_vole_commit_column(const uint8_t* rootKey, const uint8_t* iv, unsig
       H1_final(&com_ctx, h, lambda_bytes * 2);
       H1_update(&hcom_ctx, h, lambda_bytes * 2);
     }
+    if (stats) {
+      stats->leaves_expanded += num_seeds;
+      stats->prg_bytes += (uint64_t)num_seeds * ellhat_bytes;
+    }
+    if (vole_mode.column_fn) {
+      for (unsigned int j = 0; j < v_end - v_start; j++) {
+        vole_mode.column_fn(vole_mode.column_ctx, vole_mode.v + j * ellhat_bytes);
+      }
+    }
 
     v_progress += tree_depth;
   }
 
   if (vole_mode.mode != EXCLUDE_U_HCOM_C) {
     H1_final(&hcom_ctx, vole_mode.hcom, lambda_bytes * 2);
-    free(h);
+    faest_arena_free(scratch, h);
   }
 
-  free(r);
-  free(expanded_keys);
-  free(path);
+  faest_arena_free(scratch, r);
+  faest_arena_free(scratch, expanded_keys);
+  faest_arena_free(scratch, path);
+  faest_arena_reset(scratch, mark);
 }
 
-void partial_vole_commit_row(const uint8_t* rootKey, const uint8_t* iv, unsigned int ellhat,
-                             unsigned int start, unsigned int end, const faest_paramset_t* params,
-                             uint8_t* v) {
-  unsigned int lambda       = params->faest_param.lambda;
-  unsigned int lambda_bytes = lambda / 8;
-  unsigned int ellhat_bytes = (ellhat + 7) / 8;
-  unsigned int tau          = params->faest_param.tau;
-  unsigned int tau0         = params->faest_param.t0;
-  unsigned int k0           = params->faest_param.k0;
-  unsigned int k1           = params->faest_param.k1;
-  unsigned int max_depth    = MAX(k0, k1);
+// Shared state of the row functions
+typedef struct row_ctx_t {
+  const uint8_t* iv;
+  unsigned int lambda;
+  unsigned int start;
+  unsigned int len;
+  unsigned int first_block; // First PRG block covering the rows
+  unsigned int nblocks;     // Number of PRG blocks covering the rows
+  uint8_t* r;
+  uint8_t* r_trunc;
+  uint8_t* v;
+  faest_vbb_stats_t* stats;
+} row_ctx_t;
+
+// Only the PRG blocks covering bits [start, start + len) are computed. One more byte may be read
+// when the rows are not aligned.
+static row_ctx_t init_row_ctx(const uint8_t* iv, unsigned int lambda, unsigned int start,
+                              unsigned int len, uint8_t* v, faest_vbb_stats_t* stats,
+                              faest_arena_t* scratch) {
+  const unsigned int start_byte = start / 8;
+  const unsigned int end_byte   = start_byte + (len + 7) / 8;
+
+  row_ctx_t ctx = {iv, lambda, start, len, start_byte / 16, end_byte / 16 - start_byte / 16 + 1,
+                   NULL, NULL, v, stats};
+  ctx.r       = faest_arena_alloc(scratch, ctx.nblocks * 16);
+  ctx.r_trunc = faest_arena_alloc(scratch, (len + 7) / 8);
+  return ctx;
+}
+
+// Expand seed sd and XOR the requested rows of the expansion into the columns col_idx + j of v for
+// which bit j of index is set.
+static void apply_seed_rows(const row_ctx_t* ctx, const uint8_t* sd, unsigned int index,
+                            unsigned int depth, unsigned int col_idx) {
+  const unsigned int lambda    = ctx->lambda;
+  const unsigned int start     = ctx->start;
+  const unsigned int len       = ctx->len;
+  const unsigned int len_bytes = (len + 7) / 8;
+  uint8_t* r_trunc             = ctx->r_trunc;
+
+  // r points to the byte holding bit start
+  prg_range(sd, ctx->iv, ctx->first_block, ctx->r, lambda, ctx->nblocks);
+  if (ctx->stats) {
+    ++ctx->stats->leaves_expanded;
+    ctx->stats->prg_bytes += ctx->nblocks * 16;
+  }
+  const uint8_t* r = ctx->r + (start / 8 - ctx->first_block * 16);
+
+  // Extract and align the requested part of r
+  extract_bits(r_trunc, r, start % 8, len);
+
+  // XOR directly into v instead of maintaining a stack to save memory
+  for (unsigned int j = 0; j < depth; j++) {
+    // Only apply to correct entries
+    if ((index >> j) & 1) {
+      // XOR into the blocks of 8 rows
+      for (unsigned int k = 0; k < len_bytes; k++) {
+        ctx->v[k * lambda + col_idx + j] ^= r_trunc[k];
+      }
+    }
+  }
+}
+
+ATTR_CONST static inline unsigned int tree_depth(unsigned int t, const faest_paramset_t* params) {
+  return t < params->faest_param.t0 ? params->faest_param.k0 : params->faest_param.k1;
+}
+
+// Index of the first node of tree t in the checkpoint
+static size_t checkpoint_offset(unsigned int level, unsigned int t, const faest_paramset_t* params) {
+  size_t offset = 0;
+  for (unsigned int i = 0; i < t; i++) {
+    offset += (size_t)1 << MIN(level, tree_depth(i, params));
+  }
+  return offset;
+}
 
-  unsigned int len       = end - start;
-  unsigned int len_bytes = (len + 7) / 8;
+size_t vole_checkpoint_nodes(unsigned int level, const faest_paramset_t* params) {
+  return checkpoint_offset(level, params->faest_param.tau, params);
+}
 
-  uint8_t* expanded_keys = malloc(tau * lambda_bytes);
+size_t vole_scratch_bytes(unsigned int checkpoint_level, const faest_paramset_t* params) {
+  const unsigned int lambda       = params->faest_param.lambda;
+  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int ellhat       = params->faest_param.l + lambda * 2 + UNIVERSAL_HASH_B_BITS;
+  const unsigned int max_depth    = MAX(params->faest_param.k0, params->faest_param.k1);
+  // r, r_trunc and the leaves of one checkpoint node or the expanded keys and the path
+  size_t rows = faest_arena_bytes((ellhat + 7) / 8 + 32) + faest_arena_bytes((ellhat + 7) / 8);
+  if (checkpoint_level && checkpoint_level < max_depth) {
+    rows += faest_arena_bytes((size_t)lambda_bytes << (max_depth - checkpoint_level));
+  }
+  rows += faest_arena_bytes(params->faest_param.tau * lambda_bytes) +
+          faest_arena_bytes(lambda_bytes * max_depth * 2);
+  // h and the buffers of the vector reconstruction
+  const size_t reconstruction =
+      faest_arena_bytes(lambda_bytes * 2) + faest_arena_bytes(max_depth) +
+      faest_arena_bytes(max_depth * lambda_bytes) + faest_arena_bytes(lambda_bytes * 2) +
+      faest_arena_bytes(lambda_bytes * (max_depth - 1) * 2);
+  return rows + reconstruction;
+}
+
+// Replace the leaves of a tree by their seeds, skipping the leaf at index skip
+static void checkpoint_leaf_seeds(uint8_t* nodes, unsigned int depth, unsigned int skip,
+                                  const uint8_t* iv, unsigned int lambda) {
+  const unsigned int lambda_bytes = lambda / 8;
   uint8_t sd[MAX_LAMBDA_BYTES];
   uint8_t com[2 * MAX_LAMBDA_BYTES];
-  uint8_t* r             = malloc(ellhat_bytes);
-  uint8_t* path          = malloc(lambda_bytes * max_depth * 2);
-  uint8_t* r_trunc       = malloc(len_bytes);
 
-  vec_com_t vec_com;
-  memset(v, 0, ((size_t)len) * (size_t)lambda_bytes);
+  for (unsigned int i = 0; i < (1u << depth); i++) {
+    if (i != skip) {
+      leaf_sd_com(nodes + i * lambda_bytes, iv, lambda, sd, com);
+      memcpy(nodes + i * lambda_bytes, sd, lambda_bytes);
+    }
+  }
+}
+
+void vole_checkpoint_commit(vole_checkpoint_t* checkpoint, const uint8_t* rootKey,
+                            const uint8_t* iv, const faest_paramset_t* params,
+                            faest_arena_t* scratch) {
+  const unsigned int lambda       = params->faest_param.lambda;
+  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int tau          = params->faest_param.tau;
+  const size_t mark               = faest_arena_mark(scratch);
+
+  uint8_t* expanded_keys = faest_arena_alloc(scratch, tau * lambda_bytes);
   prg(rootKey, iv, expanded_keys, lambda, lambda_bytes * tau);
 
-  unsigned int col_idx = 0;
-  // Iterate over each tree
+  uint8_t* nodes = checkpoint->nodes;
   for (unsigned int t = 0; t < tau; t++) {
-    unsigned int depth         = t < tau0 ? k0 : k1;
-    unsigned int num_instances = 1 << depth;
+    const unsigned int depth = tree_depth(t, params);
+    const unsigned int level = MIN(checkpoint->level, depth);
 
-    vector_commitment(expanded_keys + t * lambda_bytes, lambda, depth, path, &vec_com);
+    expand_nodes(expanded_keys + t * lambda_bytes, iv, lambda, level, nodes);
+    if (level == depth) {
+      checkpoint_leaf_seeds(nodes, depth, 1u << depth, iv, lambda);
+    }
+    nodes += ((size_t)lambda_bytes) << level;
+  }
 
-    // Iterate each seed emmited from the tree
-    for (unsigned int i = 0; i < num_instances; i++) {
-      extract_sd_com(&vec_com, iv, lambda, i, sd, com);
-      prg(sd, iv, r, lambda, ellhat_bytes);
-
-      // Extract and align the requested part of r
-      unsigned int bit_offset = start % 8;
-      unsigned int start_byte = start / 8;
-      // If aligned, copy over
-      if (bit_offset == 0) {
-        memcpy(r_trunc, r + start_byte, len_bytes);
-      } else { // If not aligned
-        for (unsigned int j = 0; j < len_bytes; j++) {
-          r_trunc[j] =
-              (r[start_byte + j] >> bit_offset) | (r[start_byte + j + 1] << (8 - bit_offset));
-        }
-        // Get last part
-        r_trunc[len_bytes - 1] = (r[start_byte + len_bytes - 1] >> bit_offset);
-        unsigned int rest      = len - (len_bytes - 1) * 8;
-        if (rest > 8 - bit_offset) {
-          // Get extra part
-          r_trunc[len_bytes - 1] |= r[start_byte + len_bytes] << (8 - bit_offset);
+  faest_arena_free(scratch, expanded_keys);
+  faest_arena_reset(scratch, mark);
+}
+
+void vole_checkpoint_reconstruct(vole_checkpoint_t* checkpoint, const uint8_t* iv,
+                                 const uint8_t* chall, const uint8_t* const* pdec,
+                                 const faest_paramset_t* params) {
+  const unsigned int lambda       = params->faest_param.lambda;
+  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int tau          = params->faest_param.tau;
+
+  uint8_t* nodes = checkpoint->nodes;
+  for (unsigned int t = 0; t < tau; t++) {
+    const unsigned int depth = tree_depth(t, params);
+    const unsigned int level = MIN(checkpoint->level, depth);
+
+    uint8_t chalout[MAX_DEPTH];
+    ChalDec(chall, t, params->faest_param.k0, params->faest_param.t0, params->faest_param.k1,
+            params->faest_param.t1, chalout);
+    const unsigned int hidden = NumRec(depth, chalout);
+
+    // The opened nodes are the siblings of the path to the hidden leaf, which itself is unknown
+    memset(nodes + (size_t)(hidden >> (depth - level)) * lambda_bytes, 0, lambda_bytes);
+    for (unsigned int m = 1; m <= level; m++) {
+      const unsigned int sibling = (hidden >> (depth - m)) ^ 1;
+      expand_nodes(pdec[t] + (m - 1) * lambda_bytes, iv, lambda, level - m,
+                   nodes + ((size_t)sibling << (level - m)) * lambda_bytes);
+    }
+    if (level == depth) {
+      checkpoint_leaf_seeds(nodes, depth, hidden, iv, lambda);
+    }
+    nodes += ((size_t)lambda_bytes) << level;
+  }
+}
+
+// Apply all leaves of a tree using the checkpoint nodes of the tree. For the verifier, vec_com_rec
+// holds the reconstructed tree and hidden is the index of the unknown leaf, whose checkpoint node is
+// unknown as well. The leaves below it are thus extracted from vec_com_rec.
+static void apply_checkpoint_tree(const row_ctx_t* ctx, const vole_checkpoint_t* checkpoint,
+                                  const uint8_t* nodes, unsigned int depth, unsigned int col_idx,
+                                  vec_com_rec_t* vec_com_rec, unsigned int hidden,
+                                  uint8_t* leaves) {
+  const unsigned int lambda       = ctx->lambda;
+  const unsigned int lambda_bytes = lambda / 8;
+  const unsigned int level        = MIN(checkpoint->level, depth);
+  const unsigned int sub_depth    = depth - level;
+
+  uint8_t sd[MAX_LAMBDA_BYTES];
+  uint8_t com[2 * MAX_LAMBDA_BYTES];
+  for (unsigned int j = 0; j < (1u << level); j++) {
+    const unsigned int first_leaf = j << sub_depth;
+
+    if (vec_com_rec && j == hidden >> sub_depth) {
+      for (unsigned int i = first_leaf; i < first_leaf + (1u << sub_depth); i++) {
+        if (i != hidden) {
+          extract_sd_com_rec(vec_com_rec, ctx->iv, lambda, i, sd, com);
+          apply_seed_rows(ctx, sd, i ^ hidden, depth, col_idx);
         }
       }
-      // Clear final bits
-      unsigned int bit_to_clear = (8 - (len % 8)) % 8;
-      r_trunc[len_bytes - 1] &= (uint8_t)0xFF >> bit_to_clear;
-
-      // XOR directly into v instead of maintaining a stack to save memory
-      for (unsigned int j = 0; j < depth; j++) {
-        // Only apply to correct entries
-        if ((i >> j) & 1) {
-          // Shift offset and XOR into v
-          unsigned long row_bit_index   = (unsigned long)len * (unsigned long)(col_idx + j);
-          unsigned long row_bit_offset  = row_bit_index % 8;
-          unsigned long row_byte_offset = row_bit_index / 8;
-          // Apply first byte
-          v[row_byte_offset] ^= r_trunc[0] << row_bit_offset;
-          // Apply the remaining
-          for (unsigned int k = 1; k < len_bytes; k++) {
-            v[row_byte_offset + k] ^=
-                (r_trunc[k - 1] >> (8 - row_bit_offset)) | (r_trunc[k] << row_bit_offset);
-          }
+      continue;
+    }
 
-          if (row_bit_offset != 0) {
-            v[row_byte_offset + len_bytes] ^= r_trunc[len_bytes - 1] >> (8 - row_bit_offset);
-          }
-        }
+    const uint8_t* node = nodes + j * lambda_bytes;
+    if (!sub_depth) {
+      // leaf seeds are stored directly
+      apply_seed_rows(ctx, node, first_leaf ^ hidden, depth, col_idx);
+      continue;
+    }
+    expand_nodes(node, ctx->iv, lambda, sub_depth, leaves);
+    for (unsigned int i = 0; i < (1u << sub_depth); i++) {
+      leaf_sd_com(leaves + i * lambda_bytes, ctx->iv, lambda, sd, com);
+      apply_seed_rows(ctx, sd, (first_leaf + i) ^ hidden, depth, col_idx);
+    }
+  }
+}
+
+// Buffer for the leaves below one checkpoint node
+static uint8_t* alloc_checkpoint_leaves(const vole_checkpoint_t* checkpoint,
+                                        const faest_paramset_t* params, faest_arena_t* scratch) {
+  const unsigned int max_depth = MAX(params->faest_param.k0, params->faest_param.k1);
+  if (!checkpoint || checkpoint->level >= max_depth) {
+    return NULL;
+  }
+  return faest_arena_alloc(scratch,
+                           ((size_t)params->faest_param.lambda / 8) << (max_depth - checkpoint->level));
+}
+
+void partial_vole_commit_row(const uint8_t* rootKey, const uint8_t* iv, unsigned int start,
+                             unsigned int end, const faest_paramset_t* params, uint8_t* v,
+                             const vole_checkpoint_t* checkpoint, faest_vbb_stats_t* stats,
+                             faest_arena_t* scratch) {
+  unsigned int lambda       = params->faest_param.lambda;
+  unsigned int lambda_bytes = lambda / 8;
+  unsigned int tau          = params->faest_param.tau;
+  unsigned int k0           = params->faest_param.k0;
+  unsigned int k1           = params->faest_param.k1;
+  unsigned int max_depth    = MAX(k0, k1);
+
+  unsigned int len  = end - start;
+  const size_t mark = faest_arena_mark(scratch);
+
+  uint8_t sd[MAX_LAMBDA_BYTES];
+  uint8_t com[2 * MAX_LAMBDA_BYTES];
+  row_ctx_t ctx = init_row_ctx(iv, lambda, start, len, v, stats, scratch);
+  memset(v, 0, ((size_t)len) * (size_t)lambda_bytes);
+
+  if (checkpoint) {
+    uint8_t* leaves = alloc_checkpoint_leaves(checkpoint, params, scratch);
+    unsigned int col_idx = 0;
+    for (unsigned int t = 0; t < tau; t++) {
+      unsigned int depth = tree_depth(t, params);
+      apply_checkpoint_tree(&ctx, checkpoint,
+                            checkpoint->nodes +
+                                checkpoint_offset(checkpoint->level, t, params) * lambda_bytes,
+                            depth, col_idx, NULL, 0, leaves);
+      col_idx += depth;
+    }
+    faest_arena_free(scratch, leaves);
+  } else {
+    uint8_t* expanded_keys = faest_arena_alloc(scratch, tau * lambda_bytes);
+    uint8_t* path          = faest_arena_alloc(scratch, lambda_bytes * max_depth * 2);
+    prg(rootKey, iv, expanded_keys, lambda, lambda_bytes * tau);
+
+    vec_com_t vec_com;
+    unsigned int col_idx = 0;
+    // Iterate over each tree
+    for (unsigned int t = 0; t < tau; t++) {
+      unsigned int depth         = tree_depth(t, params);
+      unsigned int num_instances = 1 << depth;
+
+      vector_commitment(expanded_keys + t * lambda_bytes, lambda, depth, path, &vec_com);
+
+      // Iterate each seed emmited from the tree
+      for (unsigned int i = 0; i < num_instances; i++) {
+        extract_sd_com(&vec_com, iv, lambda, i, sd, com);
+        apply_seed_rows(&ctx, sd, i, depth, col_idx);
       }
+      col_idx += depth;
     }
-    col_idx += depth;
+
+    faest_arena_free(scratch, expanded_keys);
+    faest_arena_free(scratch, path);
   }
 
-  free(r);
-  free(expanded_keys);
-  free(path);
-  free(r_trunc);
+  faest_arena_free(scratch, ctx.r);
+  faest_arena_free(scratch, ctx.r_trunc);
+  faest_arena_reset(scratch, mark);
 }
 
 void partial_vole_reconstruct_column(const uint8_t* iv, const uint8_t* chall,
                                      const uint8_t* const* pdec, const uint8_t* const* com_j,
                                      unsigned int ellhat, unsigned int start, unsigned int len,
                                      verify_vole_mode_ctx_t vole_mode,
-                                     const faest_paramset_t* params) {
+                                     const faest_paramset_t* params, faest_vbb_stats_t* stats,
+                                     faest_arena_t* scratch) {
   unsigned int lambda       = params->faest_param.lambda;
   unsigned int lambda_bytes = lambda / 8;
   unsigned int ellhat_bytes = (ellhat + 7) / 8;
@@ -265,28 +483,29 @@ void partial_vole_reconstruct_column(const uint8_t* iv, const uint8_t* chall,
   unsigned int tau1         = params->faest_param.t1;
   unsigned int k0           = params->faest_param.k0;
   unsigned int k1           = params->faest_param.k1;
+  const size_t mark         = faest_arena_mark(scratch);
 
   H1_context_t hcom_ctx;
   H1_context_t com_ctx;
   uint8_t* h = NULL;
   if (vole_mode.mode != EXCLUDE_HCOM) {
     H1_init(&hcom_ctx, lambda);
-    h = malloc(lambda_bytes * 2);
+    h = faest_arena_alloc(scratch, lambda_bytes * 2);
   }
 
   unsigned int max_depth = MAX(k0, k1);
   vec_com_rec_t vec_com_rec;
-  vec_com_rec.b     = malloc(max_depth * sizeof(uint8_t));
-  vec_com_rec.nodes = malloc(max_depth * lambda_bytes);
+  vec_com_rec.b     = faest_arena_alloc(scratch, max_depth * sizeof(uint8_t));
+  vec_com_rec.nodes = faest_arena_alloc(scratch, max_depth * lambda_bytes);
   memset(vec_com_rec.nodes, 0, max_depth * lambda_bytes);
-  vec_com_rec.com_j   = malloc(lambda_bytes * 2);
-  uint8_t* tree_nodes = malloc(lambda_bytes * (max_depth - 1) * 2);
+  vec_com_rec.com_j   = faest_arena_alloc(scratch, lambda_bytes * 2);
+  uint8_t* tree_nodes = faest_arena_alloc(scratch, lambda_bytes * (max_depth - 1) * 2);
 
   uint8_t sd[MAX_LAMBDA_BYTES];
   uint8_t com[2 * MAX_LAMBDA_BYTES];
   uint8_t* r;
   if (vole_mode.mode != EXCLUDE_Q) {
-    r = malloc(ellhat_bytes);
+    r = faest_arena_alloc(scratch, ellhat_bytes);
   }
 
   unsigned int end = start + len;
@@ -346,6 +565,10 @@ void partial_vole_reconstruct_column(const uint8_t* iv, const uint8_t* chall,
       }
       if (vole_mode.mode != EXCLUDE_Q) {
         prg(sd, iv, r, lambda, ellhat_bytes);
+        if (stats) {
+          ++stats->leaves_expanded;
+          stats->prg_bytes += ellhat_bytes;
+        }
         for (unsigned int j = q_begin; j < q_end; j++) {
           uint8_t* write_idx = (vole_mode.q + (j - q_begin + q_cache_offset) * ellhat_bytes);
           unsigned int q_v   = j - q_progress;
@@ -366,114 +589,225 @@ void partial_vole_reconstruct_column(const uint8_t* iv, const uint8_t* chall,
   }
 
   if (vole_mode.mode != EXCLUDE_Q) {
-    free(r);
+    faest_arena_free(scratch, r);
   }
-  free(vec_com_rec.b);
-  free(vec_com_rec.nodes);
-  free(vec_com_rec.com_j);
-  free(tree_nodes);
+  faest_arena_free(scratch, vec_com_rec.b);
+  faest_arena_free(scratch, vec_com_rec.nodes);
+  faest_arena_free(scratch, vec_com_rec.com_j);
+  faest_arena_free(scratch, tree_nodes);
   if (vole_mode.mode != EXCLUDE_HCOM) {
     H1_final(&hcom_ctx, vole_mode.hcom, lambda_bytes * 2);
-    free(h);
+    faest_arena_free(scratch, h);
   }
+  faest_arena_reset(scratch, mark);
 }
 
 void partial_vole_reconstruct_row(const uint8_t* iv, const uint8_t* chall,
                                   const uint8_t* const* pdec, const uint8_t* const* com_j,
-                                  uint8_t* q, unsigned int ellhat, const faest_paramset_t* params,
-                                  unsigned int start, unsigned int len) {
+                                  uint8_t* q, const faest_paramset_t* params, unsigned int start,
+                                  unsigned int len, const vole_checkpoint_t* checkpoint,
+                                  faest_vbb_stats_t* stats, faest_arena_t* scratch) {
   unsigned int lambda       = params->faest_param.lambda;
   unsigned int lambda_bytes = lambda / 8;
-  unsigned int ellhat_bytes = (ellhat + 7) / 8;
   unsigned int tau          = params->faest_param.tau;
   unsigned int tau0         = params->faest_param.t0;
   unsigned int tau1         = params->faest_param.t1;
   unsigned int k0           = params->faest_param.k0;
   unsigned int k1           = params->faest_param.k1;
 
-  unsigned int len_bytes = (len + 7) / 8;
-
   unsigned int max_depth = MAX(k0, k1);
+  const size_t mark      = faest_arena_mark(scratch);
   vec_com_rec_t vec_com_rec;
-  vec_com_rec.b       = malloc(max_depth * sizeof(uint8_t));
-  vec_com_rec.nodes   = calloc(max_depth, lambda_bytes);
-  vec_com_rec.com_j   = malloc(lambda_bytes * 2);
-  uint8_t* tree_nodes = malloc(lambda_bytes * (max_depth - 1) * 2);
+  vec_com_rec.b       = faest_arena_alloc(scratch, max_depth * sizeof(uint8_t));
+  vec_com_rec.nodes   = faest_arena_alloc(scratch, max_depth * lambda_bytes);
+  vec_com_rec.com_j   = faest_arena_alloc(scratch, lambda_bytes * 2);
+  uint8_t* tree_nodes = faest_arena_alloc(scratch, lambda_bytes * (max_depth - 1) * 2);
+  uint8_t* leaves     = alloc_checkpoint_leaves(checkpoint, params, scratch);
+  memset(vec_com_rec.nodes, 0, max_depth * lambda_bytes);
 
   uint8_t sd[MAX_LAMBDA_BYTES];
   uint8_t com[2 * MAX_LAMBDA_BYTES];
-  uint8_t* r   = malloc(ellhat_bytes);
-  uint8_t* r_trunc = malloc(len_bytes);
+  row_ctx_t ctx = init_row_ctx(iv, lambda, start, len, q, stats, scratch);
 
   memset(q, 0, len * lambda_bytes);
 
   unsigned int col_idx = 0;
   for (unsigned int t = 0; t < tau; t++) {
-    unsigned int depth = t < tau0 ? k0 : k1;
+    unsigned int depth = tree_depth(t, params);
     uint8_t chalout[MAX_DEPTH];
     ChalDec(chall, t, k0, tau0, k1, tau1, chalout);
     vector_reconstruction(pdec[t], com_j[t], chalout, lambda, depth, tree_nodes, &vec_com_rec);
     unsigned int offset = NumRec(depth, vec_com_rec.b);
 
-    const unsigned int num_instances = 1 << depth;
-    for (unsigned int i = 0; i < num_instances; i++) {
-      extract_sd_com_rec(&vec_com_rec, iv, lambda, i, sd, com);
-      prg(sd, iv, r, lambda, ellhat_bytes);
-      unsigned int offset_index = i ^ offset;
-
-      // Extract and align the requested part of r
-      unsigned int bit_offset = start % 8;
-      unsigned int start_byte = start / 8;
-      // If aligned, copy over
-      if (bit_offset == 0) {
-        memcpy(r_trunc, r + start_byte, len_bytes);
-      } else { // If not aligned
-        for (unsigned int j = 0; j < len_bytes; j++) {
-          r_trunc[j] =
-              (r[start_byte + j] >> bit_offset) | (r[start_byte + j + 1] << (8 - bit_offset));
-        }
-        // Get last part
-        r_trunc[len_bytes - 1] = (r[start_byte + len_bytes - 1] >> bit_offset);
-        unsigned int rest      = len - (len_bytes - 1) * 8;
-        if (rest > 8 - bit_offset) {
-          // Get extra part
-          r_trunc[len_bytes - 1] |= r[start_byte + len_bytes] << (8 - bit_offset);
-        }
-      }
-      // Clear final bits
-      unsigned int bit_to_clear = (8 - (len % 8)) % 8;
-      r_trunc[len_bytes - 1] &= (uint8_t)0xFF >> bit_to_clear;
-
-      // XOR directly into v instead of maintaining a stack to save memory
-      for (unsigned int j = 0; j < depth; j++) {
-        // Only apply to correct entries
-        if ((offset_index >> j) & 1) {
-          // Shift offset and XOR into v
-          unsigned long row_bit_index   = (unsigned long)len * (unsigned long)(col_idx + j);
-          unsigned long row_bit_offset  = row_bit_index % 8;
-          unsigned long row_byte_offset = row_bit_index / 8;
-          // Apply first byte
-          q[row_byte_offset] ^= r_trunc[0] << row_bit_offset;
-          // Apply the remaining
-          for (unsigned int k = 1; k < len_bytes; k++) {
-            q[row_byte_offset + k] ^=
-                (r_trunc[k - 1] >> (8 - row_bit_offset)) | (r_trunc[k] << row_bit_offset);
-          }
-
-          if (row_bit_offset != 0) {
-            q[row_byte_offset + len_bytes] ^= r_trunc[len_bytes - 1] >> (8 - row_bit_offset);
-          }
-        }
+    if (checkpoint) {
+      apply_checkpoint_tree(&ctx, checkpoint,
+                            checkpoint->nodes +
+                                checkpoint_offset(checkpoint->level, t, params) * lambda_bytes,
+                            depth, col_idx, &vec_com_rec, offset, leaves);
+    } else {
+      const unsigned int num_instances = 1 << depth;
+      for (unsigned int i = 0; i < num_instances; i++) {
+        extract_sd_com_rec(&vec_com_rec, iv, lambda, i, sd, com);
+        apply_seed_rows(&ctx, sd, i ^ offset, depth, col_idx);
       }
     }
 
     col_idx += depth;
   }
 
-  free(r);
-  free(vec_com_rec.b);
-  free(vec_com_rec.nodes);
-  free(vec_com_rec.com_j);
-  free(tree_nodes);
-  free(r_trunc);
+  faest_arena_free(scratch, ctx.r);
+  faest_arena_free(scratch, ctx.r_trunc);
+  faest_arena_free(scratch, leaves);
+  faest_arena_free(scratch, vec_com_rec.b);
+  faest_arena_free(scratch, vec_com_rec.nodes);
+  faest_arena_free(scratch, vec_com_rec.com_j);
+  faest_arena_free(scratch, tree_nodes);
+  faest_arena_reset(scratch, mark);
+}
+
+// Transpose the 8x8 bit matrix x: bit j of byte i is moved to bit i of byte j
+ATTR_CONST static inline uint64_t transpose_8x8(uint64_t x) {
+  uint64_t t;
+  t = (x ^ (x >> 7)) & UINT64_C(0x00AA00AA00AA00AA);
+  x ^= t ^ (t << 7);
+  t = (x ^ (x >> 14)) & UINT64_C(0x0000CCCC0000CCCC);
+  x ^= t ^ (t << 14);
+  t = (x ^ (x >> 28)) & UINT64_C(0x00000000F0F0F0F0);
+  x ^= t ^ (t << 28);
+  return x;
+}
+
+static void transpose_row_block_uint64(uint8_t* block, unsigned int lambda) {
+  const unsigned int lambda_bytes = lambda / 8;
+  uint8_t columns[MAX_LAMBDA_BYTES * 8];
+
+  memcpy(columns, block, lambda);
+  for (unsigned int i = 0; i < lambda_bytes; ++i) {
+    uint64_t x;
+    memcpy(&x, columns + i * 8, sizeof(x));
+    x = transpose_8x8(le64toh(x));
+    for (unsigned int row = 0; row < 8; ++row) {
+      block[row * lambda_bytes + i] = x >> (row * 8);
+    }
+  }
+}
+
+#if defined(__SSE2__)
+// Collect the bits of 16 columns at once. Bit 7 of each byte is extracted with movemask, adding the
+// vector to itself moves the next bit into position.
+ATTR_TARGET_SSE2 static void transpose_row_block_sse2(uint8_t* block, unsigned int lambda) {
+  const unsigned int lambda_bytes = lambda / 8;
+  uint8_t columns[MAX_LAMBDA_BYTES * 8];
+
+  memcpy(columns, block, lambda);
+  for (unsigned int i = 0; i < lambda / 16; ++i) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(columns + i * 16));
+    for (unsigned int row = 8; row-- > 0; x = _mm_add_epi8(x, x)) {
+      const uint16_t bits = _mm_movemask_epi8(x);
+      memcpy(block + row * lambda_bytes + i * 2, &bits, sizeof(bits));
+    }
+  }
+}
+#endif
+
+#if defined(HAVE_AVX2_TARGET)
+ATTR_TARGET_AVX2 static void transpose_row_block_avx2(uint8_t* block, unsigned int lambda) {
+  const unsigned int lambda_bytes = lambda / 8;
+  uint8_t columns[MAX_LAMBDA_BYTES * 8];
+
+  memcpy(columns, block, lambda);
+  for (unsigned int i = 0; i < lambda / 32; ++i) {
+    __m256i x = _mm256_loadu_si256((const __m256i*)(columns + i * 32));
+    for (unsigned int row = 8; row-- > 0; x = _mm256_add_epi8(x, x)) {
+      const uint32_t bits = _mm256_movemask_epi8(x);
+      memcpy(block + row * lambda_bytes + i * 4, &bits, sizeof(bits));
+    }
+  }
+}
+#endif
+
+void transpose_row_blocks(uint8_t* v, unsigned int len, unsigned int lambda) {
+  void (*transpose_row_block)(uint8_t*, unsigned int) = transpose_row_block_uint64;
+#if defined(__SSE2__)
+  transpose_row_block = transpose_row_block_sse2;
+#endif
+#if defined(HAVE_AVX2_TARGET)
+  if (__builtin_cpu_supports("avx2")) {
+    transpose_row_block = transpose_row_block_avx2;
+  }
+#endif
+
+  for (unsigned int i = 0; i < len / 8; ++i) {
+    transpose_row_block(v + i * lambda, lambda);
+  }
+}
+
+// Bytes j of the output combine bytes j and j + 1 of src, so full words are handled as long as src
+// has a byte after them. Returns the number of bytes written.
+static unsigned int extract_bits_uint64(uint8_t* dst, const uint8_t* src, unsigned int shift,
+                                        unsigned int src_bytes) {
+  unsigned int j = 0;
+  for (; j + sizeof(uint64_t) < src_bytes; j += sizeof(uint64_t)) {
+    uint64_t x;
+    memcpy(&x, src + j, sizeof(x));
+    x = (le64toh(x) >> shift) | ((uint64_t)src[j + sizeof(uint64_t)] << (64 - shift));
+    x = htole64(x);
+    memcpy(dst + j, &x, sizeof(x));
+  }
+  return j;
+}
+
+#if defined(HAVE_AVX2_TARGET)
+// There are no 8-bit shifts, so the bits crossing into the neighboring byte of the 16-bit shifts
+// are masked off.
+ATTR_TARGET_AVX2 static unsigned int extract_bits_avx2(uint8_t* dst, const uint8_t* src,
+                                                       unsigned int shift, unsigned int src_bytes) {
+  const __m128i count_lo = _mm_cvtsi32_si128(shift);
+  const __m128i count_hi = _mm_cvtsi32_si128(8 - shift);
+  const __m256i mask_lo  = _mm256_set1_epi8((char)(0xFF >> shift));
+  const __m256i mask_hi  = _mm256_set1_epi8((char)(0xFF << (8 - shift)));
+
+  unsigned int j = 0;
+  for (; j + sizeof(__m256i) < src_bytes; j += sizeof(__m256i)) {
+    const __m256i lo = _mm256_loadu_si256((const __m256i*)(src + j));
+    const __m256i hi = _mm256_loadu_si256((const __m256i*)(src + j + 1));
+    const __m256i x  = _mm256_or_si256(_mm256_and_si256(_mm256_srl_epi16(lo, count_lo), mask_lo),
+                                       _mm256_and_si256(_mm256_sll_epi16(hi, count_hi), mask_hi));
+    _mm256_storeu_si256((__m256i*)(dst + j), x);
+  }
+  return j + extract_bits_uint64(dst + j, src + j, shift, src_bytes - j);
+}
+#endif
+
+void extract_bits(uint8_t* dst, const uint8_t* src, unsigned int src_bit, unsigned int nbits) {
+  const unsigned int len_bytes = (nbits + 7) / 8;
+  const unsigned int shift     = src_bit % 8;
+  if (!nbits) {
+    return;
+  }
+
+  src += src_bit / 8;
+  if (!shift) {
+    memcpy(dst, src, len_bytes);
+  } else {
+    const unsigned int src_bytes = (shift + nbits + 7) / 8;
+    unsigned int (*extract_words)(uint8_t*, const uint8_t*, unsigned int, unsigned int) =
+        extract_bits_uint64;
+#if defined(HAVE_AVX2_TARGET)
+    if (__builtin_cpu_supports("avx2")) {
+      extract_words = extract_bits_avx2;
+    }
+#endif
+
+    for (unsigned int j = extract_words(dst, src, shift, src_bytes); j < len_bytes; ++j) {
+      dst[j] = src[j] >> shift;
+      if (j + 1 < src_bytes) {
+        dst[j] |= src[j + 1] << (8 - shift);
+      }
+    }
+  }
+  // Clear final bits
+  if (nbits % 8) {
+    dst[len_bytes - 1] &= (uint8_t)0xFF >> (8 - nbits % 8);
+  }
 }
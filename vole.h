@@ -10,17 +10,24 @@
 
 #include "vc.h"
 #include "macros.h"
+#include "faest_defines.h"
+#include "arena.h"
 
 FAEST_BEGIN_C_DECL
 
 typedef enum { EXCLUDE_U_HCOM_C, EXCLUDE_HCOM, EXCLUDE_V, EXCLUDE_Q, INCLUDE_ALL } vole_mode_t;
 
+// Called with each finished column when streaming the columns of V
+typedef void (*vole_column_fn)(void* ctx, const uint8_t* column);
+
 typedef struct sign_vole_mode_ctx_t {
   vole_mode_t mode;
   uint8_t* v;
   uint8_t* u;
   uint8_t* hcom;
   uint8_t* c;
+  vole_column_fn column_fn;
+  void* column_ctx;
 } sign_vole_mode_ctx_t;
 
 ATTR_CONST ATTR_ALWAYS_INLINE inline sign_vole_mode_ctx_t
@@ -29,7 +36,7 @@ vole_mode_all_sign(uint8_t* v, uint8_t* u, uint8_t* hcom, uint8_t* c) {
   assert(u != NULL);
   assert(hcom != NULL);
   assert(c != NULL);
-  sign_vole_mode_ctx_t ctx = {INCLUDE_ALL, v, u, hcom, c};
+  sign_vole_mode_ctx_t ctx = {INCLUDE_ALL, v, u, hcom, c, NULL, NULL};
   return ctx;
 }
 
@@ -38,13 +45,23 @@ vole_mode_u_hcom_c(uint8_t* u, uint8_t* hcom, uint8_t* c) {
   assert(u != NULL);
   assert(hcom != NULL);
   assert(c != NULL);
-  sign_vole_mode_ctx_t ctx = {EXCLUDE_V, NULL, u, hcom, c};
+  sign_vole_mode_ctx_t ctx = {EXCLUDE_V, NULL, u, hcom, c, NULL, NULL};
   return ctx;
 }
 
 ATTR_CONST ATTR_ALWAYS_INLINE inline sign_vole_mode_ctx_t vole_mode_v(uint8_t* v) {
   assert(v != NULL);
-  sign_vole_mode_ctx_t ctx = {EXCLUDE_U_HCOM_C, v, NULL, NULL, NULL};
+  sign_vole_mode_ctx_t ctx = {EXCLUDE_U_HCOM_C, v, NULL, NULL, NULL, NULL, NULL};
+  return ctx;
+}
+
+// Compute the columns of V tree by tree into v, which needs to hold the columns of one tree, and
+// pass each column to fn once its tree is done.
+ATTR_CONST ATTR_ALWAYS_INLINE inline sign_vole_mode_ctx_t
+vole_mode_v_stream(uint8_t* v, vole_column_fn fn, void* fn_ctx) {
+  assert(v != NULL);
+  assert(fn != NULL);
+  sign_vole_mode_ctx_t ctx = {EXCLUDE_U_HCOM_C, v, NULL, NULL, NULL, fn, fn_ctx};
   return ctx;
 }
 
@@ -74,30 +91,68 @@ ATTR_CONST ATTR_ALWAYS_INLINE inline verify_vole_mode_ctx_t vole_mode_hcom(uint8
   return ctx;
 }
 
+// Nodes of the GGM trees at a fixed level, kept to recompute rows without expanding the upper
+// levels again. Trees whose depth is at most the level keep the seeds of their leaves instead, which
+// also saves hashing the leaves.
+typedef struct vole_checkpoint_t {
+  unsigned int level;
+  uint8_t* nodes;
+} vole_checkpoint_t;
+
+// Number of nodes of size lambda / 8 kept for the given level
+size_t vole_checkpoint_nodes(unsigned int level, const faest_paramset_t* params);
+void vole_checkpoint_commit(vole_checkpoint_t* checkpoint, const uint8_t* rootKey,
+                            const uint8_t* iv, const faest_paramset_t* params,
+                            faest_arena_t* scratch);
+void vole_checkpoint_reconstruct(vole_checkpoint_t* checkpoint, const uint8_t* iv,
+                                 const uint8_t* chall, const uint8_t* const* pdec,
+                                 const faest_paramset_t* params);
+
 // k_b is at most 12, so chalout needs to point to an array of at most 12 bytes
 int ChalDec(const uint8_t* chal, unsigned int i, unsigned int k0, unsigned int t0, unsigned int k1,
             unsigned int t1, uint8_t* chalout);
 
+// The partial VOLE functions add the expanded leaves and generated PRG bytes to stats, if it is
+// not NULL. Their temporary buffers are taken from scratch and released on return; with a NULL or
+// exhausted scratch arena, they are allocated on the heap.
+
+// Size of a scratch arena that is never exhausted by the partial VOLE functions
+size_t vole_scratch_bytes(unsigned int checkpoint_level, const faest_paramset_t* params);
+
 // Signer
 void partial_vole_commit_column(const uint8_t* rootKey, const uint8_t* iv, unsigned int ellhat,
                                 unsigned int chunk_start, unsigned int chunk_end,
-                                sign_vole_mode_ctx_t vole_mode, const faest_paramset_t* params);
+                                sign_vole_mode_ctx_t vole_mode, const faest_paramset_t* params,
+                                faest_vbb_stats_t* stats, faest_arena_t* scratch);
 
-void partial_vole_commit_row(const uint8_t* rootKey, const uint8_t* iv, unsigned int ellhat,
-                             unsigned int start, unsigned int end, const faest_paramset_t* params,
-                             uint8_t* v);
+// The row functions expand the trees from checkpoint, if it is not NULL
+void partial_vole_commit_row(const uint8_t* rootKey, const uint8_t* iv, unsigned int start,
+                             unsigned int end, const faest_paramset_t* params, uint8_t* v,
+                             const vole_checkpoint_t* checkpoint, faest_vbb_stats_t* stats,
+                             faest_arena_t* scratch);
 
 // Verifier
 void partial_vole_reconstruct_column(const uint8_t* iv, const uint8_t* chall,
                                      const uint8_t* const* pdec, const uint8_t* const* com_j,
                                      unsigned int ellhat, unsigned int start, unsigned int len,
                                      verify_vole_mode_ctx_t vole_mode,
-                                     const faest_paramset_t* params);
+                                     const faest_paramset_t* params, faest_vbb_stats_t* stats,
+                                     faest_arena_t* scratch);
 
 void partial_vole_reconstruct_row(const uint8_t* iv, const uint8_t* chall,
                                   const uint8_t* const* pdec, const uint8_t* const* com_j,
-                                  uint8_t* q, unsigned int ellhat, const faest_paramset_t* params,
-                                  unsigned int start, unsigned int len);
+                                  uint8_t* q, const faest_paramset_t* params, unsigned int start,
+                                  unsigned int len, const vole_checkpoint_t* checkpoint,
+                                  faest_vbb_stats_t* stats, faest_arena_t* scratch);
+
+// The row functions store len rows in blocks of 8 rows: bit i % 8 of byte (i / 8) * lambda + j is
+// entry j of row i. len needs to be a multiple of 8. This converts the rows in place to row-major
+// order, i.e., row i is stored in bytes i * lambda / 8 to (i + 1) * lambda / 8 - 1.
+void transpose_row_blocks(uint8_t* v, unsigned int len, unsigned int lambda);
+
+// Copies bits src_bit to src_bit + nbits - 1 of src to the first nbits bits of dst and clears the
+// remaining bits of the last byte of dst. Only the bytes of src holding these bits are read.
+void extract_bits(uint8_t* dst, const uint8_t* src, unsigned int src_bit, unsigned int nbits);
 
 FAEST_END_C_DECL
 